@@ -0,0 +1,122 @@
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+// SPDX-License-Identifier: Apache-2.0
+
+// Inter-core semaphores and doorbells behind an AXI subordinate port.
+//
+// Every register is 32 bits wide and takes a whole DATA_WIDTH-bit word, as
+// axi_to_mem only passes the word address to the register file:
+//   SEM(i)          0x000 + 8 * i  reading returns the state of the semaphore
+//                                  (0 - free, 1 - taken) and takes it, writing
+//                                  frees it
+//   DOORBELL(c)     0x100 + 8 * c  reading returns the pending bits of core c,
+//                                  writing sets the written bits
+//   DOORBELL_CLR(c) 0x180 + 8 * c  reading returns the pending bits of core c,
+//                                  writing clears the written bits
+//
+// irq_o[c] is high while core c has any doorbell bit pending. The accesses are
+// served one at a time, so taking a semaphore is atomic between the cores.
+
+module guineveer_ipc #(
+    parameter int NUM_SEMS = 32,
+    parameter int NUM_CORES = 2,
+    parameter int DATA_WIDTH = 64,
+    parameter int ID_WIDTH = 1,
+    parameter type AXI_REQ_T = logic,
+    parameter type AXI_RESP_T = logic
+) (
+    input clk_i,
+    input rst_ni,
+    input AXI_REQ_T axi_req_i,
+    output AXI_RESP_T axi_resp_o,
+    output logic [NUM_CORES-1:0] irq_o
+);
+  localparam int ADDR_WIDTH = 12;
+  localparam int WORD_BYTE_WIDTH = $clog2(DATA_WIDTH) - 3;
+  localparam int DOORBELL_BASE = 'h100 >> WORD_BYTE_WIDTH;
+  localparam int DOORBELL_CLR_BASE = 'h180 >> WORD_BYTE_WIDTH;
+
+  logic req;
+  logic we;
+  logic [ADDR_WIDTH-1:0] addr;
+  logic [DATA_WIDTH-1:0] wdata;
+  logic [DATA_WIDTH/8-1:0] strb;
+  logic [DATA_WIDTH-1:0] rdata;
+  logic rvalid;
+
+  logic [NUM_SEMS-1:0] sem_taken;
+  logic [NUM_CORES-1:0][31:0] doorbell;
+
+  axi_to_mem #(
+      .axi_req_t(AXI_REQ_T),
+      .axi_resp_t(AXI_RESP_T),
+      .AddrWidth(ADDR_WIDTH),
+      .DataWidth(DATA_WIDTH),
+      .IdWidth(ID_WIDTH),
+      .NumBanks(1)
+  ) xaxi_to_mem (
+      .clk_i,
+      .rst_ni,
+      .busy_o(),
+      .axi_req_i,
+      .axi_resp_o,
+
+      .mem_req_o(req),
+      .mem_gnt_i('1),
+      .mem_addr_o(addr),
+      .mem_wdata_o(wdata),
+      .mem_strb_o(strb),
+      .mem_atop_o(),
+      .mem_we_o(we),
+      .mem_rvalid_i(rvalid),
+      .mem_rdata_i(rdata)
+  );
+
+  wire [ADDR_WIDTH-WORD_BYTE_WIDTH-1:0] word = addr[ADDR_WIDTH-1:WORD_BYTE_WIDTH];
+  wire [31:0] wdata32 = wdata[31:0];
+  wire write32 = we && |strb[3:0];
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      rvalid <= 1'b0;
+      rdata <= '0;
+      sem_taken <= '0;
+      doorbell <= '0;
+    end else begin
+      rvalid <= req;
+
+      if (req) begin
+        rdata <= '0;
+
+        for (int i = 0; i < NUM_SEMS; i++) begin
+          if (word == i) begin
+            rdata <= DATA_WIDTH'(sem_taken[i]);
+            if (write32) sem_taken[i] <= 1'b0;
+            else if (!we) sem_taken[i] <= 1'b1;
+          end
+        end
+
+        for (int c = 0; c < NUM_CORES; c++) begin
+          if (word == DOORBELL_BASE + c) begin
+            rdata <= DATA_WIDTH'(doorbell[c]);
+            if (write32) doorbell[c] <= doorbell[c] | wdata32;
+          end
+
+          if (word == DOORBELL_CLR_BASE + c) begin
+            rdata <= DATA_WIDTH'(doorbell[c]);
+            if (write32) doorbell[c] <= doorbell[c] & ~wdata32;
+          end
+        end
+      end
+    end
+  end
+
+  for (genvar c = 0; c < NUM_CORES; c++) begin : gen_irq
+    assign irq_o[c] = |doorbell[c];
+  end
+
+  initial begin
+    if (NUM_SEMS > 'h100 >> WORD_BYTE_WIDTH) $error("%m: NUM_SEMS doesn't fit below DOORBELL");
+    if (NUM_CORES > 'h80 >> WORD_BYTE_WIDTH) $error("%m: NUM_CORES doesn't fit in DOORBELL");
+  end
+
+endmodule
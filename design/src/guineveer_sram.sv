@@ -1,72 +1,278 @@
 // Copyright (c) 2025-2026 Antmicro <www.antmicro.com>
 // SPDX-License-Identifier: Apache-2.0
 
+// Memory of MEM_SIZE bytes behind an AXI subordinate port.
+//
+// By default the memory is an array of DATA_WIDTH-bit words. Simulations
+// defining GUINEVEER_SPARSE_SRAM keep it in the page-allocated DPI model from
+// design/testbench/sparse_sram.cpp instead, which only allocates the pages that
+// were written, so memories of many megabytes cost neither host RAM nor
+// initialization time. The model only supports 64-bit words.
+//
+// With NUM_BANKS > 1 (a power of two), consecutive words are interleaved between
+// the banks and the AXI port is served by axi_to_mem_banked, which handles reads
+// and writes separately. A read and a write hitting different banks then take
+// the same cycle instead of being serialized. There is still a single read
+// channel, so reads, e.g. instruction fetches and loads, are served one at a
+// time as before, and load-heavy code doesn't benefit from the banks at all.
+// The words are still kept in one array, in address order.
+//
+// FETCH_PORT adds a second AXI subordinate port (fetch_req_i/fetch_resp_o) for
+// the instruction fetch unit of a core connected straight to the memory. It is
+// served by its own axi_to_mem, as one more bank with access to every word, so
+// fetches don't wait for the accesses coming through the interconnect. Only
+// fetches from FETCH_BASE to FETCH_BASE + MEM_SIZE, i.e. from this memory,
+// reach it; the others get a DECERR response from an axi_err_slv, which the core
+// reports as an instruction access fault.
+
 module guineveer_sram #(
     parameter string GUINEVEER_MEMORY_FILE = "",
-    parameter int ADDR_WIDTH = 32,
+    parameter int MEM_SIZE = 'h10000,
+    parameter int NUM_BANKS = 1,
+    parameter bit FETCH_PORT = 0,
+    parameter bit [31:0] FETCH_BASE = '0,
+    parameter int FETCH_ID_WIDTH = 1,
     parameter int DATA_WIDTH = 64,
     parameter int ID_WIDTH = 1,
+    parameter type AXI_AW_CHAN_T = logic,
+    parameter type AXI_W_CHAN_T = logic,
+    parameter type AXI_B_CHAN_T = logic,
+    parameter type AXI_AR_CHAN_T = logic,
+    parameter type AXI_R_CHAN_T = logic,
     parameter type AXI_REQ_T = logic,
-    parameter type AXI_RESP_T = logic
+    parameter type AXI_RESP_T = logic,
+    parameter type FETCH_AW_CHAN_T = logic,
+    parameter type FETCH_W_CHAN_T = logic,
+    parameter type FETCH_B_CHAN_T = logic,
+    parameter type FETCH_AR_CHAN_T = logic,
+    parameter type FETCH_R_CHAN_T = logic,
+    parameter type FETCH_REQ_T = logic,
+    parameter type FETCH_RESP_T = logic
 ) (
     input clk_i,
     input rst_ni,
     input AXI_REQ_T axi_req_i,
-    output AXI_RESP_T axi_resp_o
+    output AXI_RESP_T axi_resp_o,
+    input FETCH_REQ_T fetch_req_i,
+    output FETCH_RESP_T fetch_resp_o
 );
+  localparam int ADDR_WIDTH = $clog2(MEM_SIZE);
   localparam int WORD_BYTE_WIDTH = $clog2(DATA_WIDTH) - 3;
-  localparam int WORD_ADDR_COUNT = (1 << ADDR_WIDTH) >> WORD_BYTE_WIDTH;
+  localparam int WORD_ADDR_COUNT = (MEM_SIZE + (1 << WORD_BYTE_WIDTH) - 1) >> WORD_BYTE_WIDTH;
   localparam int WORD_ADDR_WIDTH = $clog2(WORD_ADDR_COUNT);
+  localparam int BANK_SEL_WIDTH = $clog2(NUM_BANKS);
+  localparam int BANK_ADDR_WIDTH = WORD_ADDR_WIDTH - BANK_SEL_WIDTH;
+  localparam int NUM_PORTS = NUM_BANKS + (FETCH_PORT ? 1 : 0);
 
-  logic mem_rvalid;
-  logic [DATA_WIDTH-1:0] mem_rdata;
-  bit [DATA_WIDTH-1:0] mem[WORD_ADDR_COUNT];
+  // Requests of every bank and of the fetch port, with the index of the word in
+  // the whole memory
+  logic [NUM_PORTS-1:0] bank_req;
+  logic [NUM_PORTS-1:0] bank_we;
+  logic [NUM_PORTS-1:0][WORD_ADDR_WIDTH-1:0] bank_word;
+  logic [NUM_PORTS-1:0][DATA_WIDTH-1:0] bank_wdata;
+  logic [NUM_PORTS-1:0][DATA_WIDTH/8-1:0] bank_strb;
+  logic [NUM_PORTS-1:0][DATA_WIDTH-1:0] bank_rdata;
+  logic [NUM_PORTS-1:0] bank_rvalid;
 
-  axi_to_mem #(
-      .axi_req_t(AXI_REQ_T),
-      .axi_resp_t(AXI_RESP_T),
-      .AddrWidth(ADDR_WIDTH),
-      .DataWidth(DATA_WIDTH),
-      .IdWidth(ID_WIDTH),
-      .NumBanks(1)
-  ) xaxi_to_mem (
-      .clk_i,
-      .rst_ni,
-      .busy_o(),
-      .axi_req_i,
-      .axi_resp_o,
-
-      .mem_req_o(),
-      .mem_gnt_i('1),
-      .mem_addr_o(),
-      .mem_wdata_o(),
-      .mem_strb_o(),
-      .mem_atop_o(),
-      .mem_we_o(),
-      .mem_rvalid_i(mem_rvalid),
-      .mem_rdata_i(mem_rdata)
+`ifdef GUINEVEER_SPARSE_SRAM
+  import "DPI-C" function chandle sparse_sram_new(input int size);
+  import "DPI-C" function longint sparse_sram_read(input chandle store, input int word);
+  import "DPI-C" function void sparse_sram_write(
+    input chandle store, input int word, input longint data, input byte strb
   );
 
+  chandle store;
+
+  // Also used by the testbench to preload the memory, possibly before the
+  // initial block of this module has run.
+  function automatic chandle backing();
+    if (store == null) store = sparse_sram_new(MEM_SIZE);
+    return store;
+  endfunction
+`else
+  bit [DATA_WIDTH-1:0] mem[WORD_ADDR_COUNT];
+`endif
+
+  if (NUM_BANKS == 1) begin : gen_single_bank
+    logic [ADDR_WIDTH-1:0] mem_addr;
+
+    axi_to_mem #(
+        .axi_req_t(AXI_REQ_T),
+        .axi_resp_t(AXI_RESP_T),
+        .AddrWidth(ADDR_WIDTH),
+        .DataWidth(DATA_WIDTH),
+        .IdWidth(ID_WIDTH),
+        .NumBanks(1)
+    ) xaxi_to_mem (
+        .clk_i,
+        .rst_ni,
+        .busy_o(),
+        .axi_req_i,
+        .axi_resp_o,
+
+        .mem_req_o(bank_req[0]),
+        .mem_gnt_i('1),
+        .mem_addr_o(mem_addr),
+        .mem_wdata_o(bank_wdata[0]),
+        .mem_strb_o(bank_strb[0]),
+        .mem_atop_o(),
+        .mem_we_o(bank_we[0]),
+        .mem_rvalid_i(bank_rvalid[0]),
+        .mem_rdata_i(bank_rdata[0])
+    );
+
+    assign bank_word[0] = WORD_ADDR_WIDTH'(mem_addr >> WORD_BYTE_WIDTH);
+  end else begin : gen_banks
+    logic [NUM_BANKS-1:0][BANK_ADDR_WIDTH-1:0] bank_addr;
+
+    axi_to_mem_banked #(
+        .IdWidth(ID_WIDTH),
+        .AddrWidth(ADDR_WIDTH),
+        .DataWidth(DATA_WIDTH),
+        .axi_aw_chan_t(AXI_AW_CHAN_T),
+        .axi_w_chan_t(AXI_W_CHAN_T),
+        .axi_b_chan_t(AXI_B_CHAN_T),
+        .axi_ar_chan_t(AXI_AR_CHAN_T),
+        .axi_r_chan_t(AXI_R_CHAN_T),
+        .axi_req_t(AXI_REQ_T),
+        .axi_resp_t(AXI_RESP_T),
+        .MemNumBanks(NUM_BANKS),
+        .MemAddrWidth(BANK_ADDR_WIDTH),
+        .MemDataWidth(DATA_WIDTH),
+        .MemLatency(1)
+    ) xaxi_to_mem_banked (
+        .clk_i,
+        .rst_ni,
+        .test_i(1'b0),
+        .axi_to_mem_busy_o(),
+        .axi_req_i,
+        .axi_resp_o,
+
+        .mem_req_o(bank_req[NUM_BANKS-1:0]),
+        .mem_gnt_i('1),
+        .mem_add_o(bank_addr),
+        .mem_we_o(bank_we[NUM_BANKS-1:0]),
+        .mem_wdata_o(bank_wdata[NUM_BANKS-1:0]),
+        .mem_be_o(bank_strb[NUM_BANKS-1:0]),
+        .mem_atop_o(),
+        .mem_rdata_i(bank_rdata[NUM_BANKS-1:0])
+    );
+
+    for (genvar i = 0; i < NUM_BANKS; i++) begin : gen_bank_word
+      assign bank_word[i] = {bank_addr[i], BANK_SEL_WIDTH'(i)};
+    end
+  end
+
+  if (FETCH_PORT) begin : gen_fetch_port
+    logic [ADDR_WIDTH-1:0] fetch_addr;
+    // Port 0 serves the accesses to this memory, port 1 answers the others with
+    // DECERR.
+    FETCH_REQ_T [1:0] fetch_reqs;
+    FETCH_RESP_T [1:0] fetch_resps;
+    logic [31:0] fetch_aw_offset, fetch_ar_offset;
+
+    assign fetch_aw_offset = fetch_req_i.aw.addr - FETCH_BASE;
+    assign fetch_ar_offset = fetch_req_i.ar.addr - FETCH_BASE;
+
+    // No spill registers, so that local fetches don't take an extra cycle.
+    axi_demux #(
+        .AxiIdWidth(FETCH_ID_WIDTH),
+        .AtopSupport(1'b0),
+        .aw_chan_t(FETCH_AW_CHAN_T),
+        .w_chan_t(FETCH_W_CHAN_T),
+        .b_chan_t(FETCH_B_CHAN_T),
+        .ar_chan_t(FETCH_AR_CHAN_T),
+        .r_chan_t(FETCH_R_CHAN_T),
+        .axi_req_t(FETCH_REQ_T),
+        .axi_resp_t(FETCH_RESP_T),
+        .NoMstPorts(2),
+        .MaxTrans(8),
+        .AxiLookBits(FETCH_ID_WIDTH),
+        .SpillAw(1'b0),
+        .SpillAr(1'b0)
+    ) xaxi_demux_fetch (
+        .clk_i,
+        .rst_ni,
+        .test_i(1'b0),
+        .slv_req_i(fetch_req_i),
+        .slv_aw_select_i(fetch_aw_offset >= MEM_SIZE),
+        .slv_ar_select_i(fetch_ar_offset >= MEM_SIZE),
+        .slv_resp_o(fetch_resp_o),
+        .mst_reqs_o(fetch_reqs),
+        .mst_resps_i(fetch_resps)
+    );
+
+    axi_err_slv #(
+        .AxiIdWidth(FETCH_ID_WIDTH),
+        .axi_req_t(FETCH_REQ_T),
+        .axi_resp_t(FETCH_RESP_T),
+        .RespWidth(DATA_WIDTH),
+        .ATOPs(1'b0)
+    ) xaxi_err_slv_fetch (
+        .clk_i,
+        .rst_ni,
+        .test_i(1'b0),
+        .slv_req_i(fetch_reqs[1]),
+        .slv_resp_o(fetch_resps[1])
+    );
+
+    axi_to_mem #(
+        .axi_req_t(FETCH_REQ_T),
+        .axi_resp_t(FETCH_RESP_T),
+        .AddrWidth(ADDR_WIDTH),
+        .DataWidth(DATA_WIDTH),
+        .IdWidth(FETCH_ID_WIDTH),
+        .NumBanks(1)
+    ) xaxi_to_mem_fetch (
+        .clk_i,
+        .rst_ni,
+        .busy_o(),
+        .axi_req_i(fetch_reqs[0]),
+        .axi_resp_o(fetch_resps[0]),
+
+        .mem_req_o(bank_req[NUM_BANKS]),
+        .mem_gnt_i('1),
+        .mem_addr_o(fetch_addr),
+        .mem_wdata_o(bank_wdata[NUM_BANKS]),
+        .mem_strb_o(bank_strb[NUM_BANKS]),
+        .mem_atop_o(),
+        .mem_we_o(bank_we[NUM_BANKS]),
+        .mem_rvalid_i(bank_rvalid[NUM_BANKS]),
+        .mem_rdata_i(bank_rdata[NUM_BANKS])
+    );
+
+    assign bank_word[NUM_BANKS] = WORD_ADDR_WIDTH'(fetch_addr >> WORD_BYTE_WIDTH);
+  end else begin : gen_no_fetch_port
+    assign fetch_resp_o = '0;
+  end
 
   always_ff @(posedge clk_i) begin
-    if (!xaxi_to_mem.mem_req_o) begin
-      mem_rvalid <= '0;
-    end else if (xaxi_to_mem.mem_req_o) begin
-      automatic logic [WORD_ADDR_WIDTH-1:0] cell_addr = {xaxi_to_mem.mem_addr_o[0] >> WORD_BYTE_WIDTH}[WORD_ADDR_WIDTH-1:0];
-
-      mem_rvalid <= '1;
-      mem_rdata  <= mem[cell_addr];
-
-      if (xaxi_to_mem.mem_we_o[0])
-        for (int i = 0; i < 8; i++)
-        if (xaxi_to_mem.mem_strb_o[0][i])
-          mem[cell_addr][8*i+:8] <= xaxi_to_mem.mem_wdata_o[0][8*i+:8];
+    bank_rvalid <= bank_req;
+
+    for (int b = 0; b < NUM_PORTS; b++) begin
+      if (bank_req[b]) begin
+`ifdef GUINEVEER_SPARSE_SRAM
+        bank_rdata[b] <= sparse_sram_read(backing(), int'(bank_word[b]));
+
+        if (bank_we[b]) sparse_sram_write(backing(), int'(bank_word[b]), bank_wdata[b], bank_strb[b]);
+`else
+        bank_rdata[b] <= mem[bank_word[b]];
+
+        if (bank_we[b])
+          for (int i = 0; i < DATA_WIDTH / 8; i++)
+          if (bank_strb[b][i]) mem[bank_word[b]][8*i+:8] <= bank_wdata[b][8*i+:8];
+`endif
+      end
     end
   end
 
   initial begin
     if (GUINEVEER_MEMORY_FILE != "") begin
+`ifdef GUINEVEER_SPARSE_SRAM
+      $error("%m: GUINEVEER_MEMORY_FILE isn't supported with GUINEVEER_SPARSE_SRAM");
+`else
       $readmemh(GUINEVEER_MEMORY_FILE, mem);
+`endif
     end
   end
 
@@ -0,0 +1,42 @@
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+// SPDX-License-Identifier: Apache-2.0
+
+// guineveer_ipc for the two cores of the dualcore designs, with the doorbell
+// interrupt of every core on its own port.
+
+`include "axi/assign.svh"
+`include "axi/port.svh"
+`include "axi/typedef.svh"
+
+module ipc_wrapper #(
+    parameter int NUM_SEMS = 32,
+    parameter int ID_WIDTH
+) (
+    `AXI_S_PORT(ipc, logic [31:0], logic [63:0], logic [7:0], logic [ID_WIDTH-1:0], logic, logic, logic,
+                logic, logic)
+    input wire clk_i,
+    input wire rst_ni,
+    output wire irq0_o,
+    output wire irq1_o
+);
+  `AXI_TYPEDEF_ALL(axi, logic [31:0], logic [ID_WIDTH-1:0], logic [63:0], logic [7:0], logic)
+  axi_req_t  axi_req;
+  axi_resp_t axi_resp;
+  `AXI_ASSIGN_SLAVE_TO_FLAT(ipc, axi_req, axi_resp)
+
+  guineveer_ipc #(
+      .NUM_SEMS  (NUM_SEMS),
+      .NUM_CORES (2),
+      .DATA_WIDTH($bits(axi_req.w.data)),
+      .ID_WIDTH  ($bits(axi_req.aw.id)),
+      .AXI_REQ_T (axi_req_t),
+      .AXI_RESP_T(axi_resp_t)
+  ) xguineveer_ipc (
+      .clk_i(clk_i),
+      .rst_ni(rst_ni),
+      .axi_req_i(axi_req),
+      .axi_resp_o(axi_resp),
+      .irq_o({irq1_o, irq0_o})
+  );
+
+endmodule
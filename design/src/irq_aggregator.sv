@@ -0,0 +1,26 @@
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+// SPDX-License-Identifier: Apache-2.0
+
+// Collects the peripheral interrupt lines and maps them onto the external
+// interrupt sources of a VeeR PIC. Source IDs start at 1, as ID 0 is reserved
+// by the PIC. The PIC synchronizes its inputs, so sources from other clock
+// domains (e.g. the I3C core) can be connected directly.
+//
+// Interrupt map:
+//   1 - I3C core (irq_o)
+//   2 - UART (irq_o)
+//   3 - inter-core doorbell of this core (ipc_wrapper irqN_o, dualcore designs)
+
+module irq_aggregator #(
+    parameter int TOTAL_INT = 8
+) (
+    input wire i3c_irq_i,
+    input wire uart_irq_i,
+    input wire ipc_irq_i,
+
+    output wire [TOTAL_INT:1] extintsrc_req_o
+);
+
+  assign extintsrc_req_o = {{(TOTAL_INT - 3) {1'b0}}, ipc_irq_i, uart_irq_i, i3c_irq_i};
+
+endmodule
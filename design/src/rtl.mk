@@ -14,7 +14,10 @@ I3C_ROOT_DIR := $(SCRIPT_DIR)/third_party/i3c-core
 PICOLIBC_DIR := $(BUILD_DIR)/picolibc
 PICOLIBC_SPECS :=  $(PICOLIBC_DIR)/install/picolibc.specs
 
-VEER_SNAPSHOT := $(BUILD_DIR)/snapshots/default
+# VeeR configuration profile, each one is built into its own snapshot.
+PROFILE ?= default
+
+VEER_SNAPSHOT := $(BUILD_DIR)/snapshots/$(PROFILE)
 VEER_FLIST := \
 	$(VEER_SNAPSHOT)/common_defines.vh \
 	$(RV_ROOT)/design/include/el2_def.sv \
@@ -52,12 +55,20 @@ VERILOG_CORE_SOURCES_RAW=\
 	$(HW_DIR)/waivers.vlt \
 	$(HW_DIR)/guineveer_sram.sv \
 	$(HW_DIR)/sram_wrapper.sv \
+	$(HW_DIR)/sram_ifu_wrapper.sv \
+	$(HW_DIR)/guineveer_ipc.sv \
+	$(HW_DIR)/ipc_wrapper.sv \
 	$(HW_DIR)/uart_wrapper.sv \
-	$(HW_DIR)/axi_cdc_wrapper.sv
+	$(HW_DIR)/axi_cdc_wrapper.sv \
+	$(HW_DIR)/irq_aggregator.sv
 
 VERILOG_CORE_SOURCES=$(strip $(call uniq,$(VERILOG_CORE_SOURCES_RAW)))
 VERILOG_SOURCES=$(VERILOG_CORE_SOURCES) $(HW_DIR)/guineveer.sv
 
+# Simulation models, which the testbenches add to VERILOG_SOURCES, but which are
+# not part of the FPGA build.
+VERILOG_SIM_SOURCES=$(TB_DIR)/veer_ccm_sram.sv
+
 VERILOG_INCLUDE_DIRS_RAW=\
     $(subst +incdir+,,$(filter +incdir+%,$(UART_FLIST))) \
 	$(subst +incdir+,,$(filter +incdir+%,$(I3C_FLIST))) \
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+// SPDX-License-Identifier: Apache-2.0
+
+`include "axi/assign.svh"
+`include "axi/port.svh"
+`include "axi/typedef.svh"
+
+// sram_wrapper with a second port, connected straight to the instruction fetch
+// unit of the core that runs from this memory, see guineveer_sram (FETCH_PORT).
+module sram_ifu_wrapper #(
+    parameter string GUINEVEER_MEMORY_FILE = "",
+    parameter int MEM_SIZE = 'h10000,
+    parameter int NUM_BANKS = 1,
+    // Address of the memory in the memory map, fetches from anywhere else fail.
+    parameter bit [31:0] MEM_BASE = '0,
+    parameter int ID_WIDTH,
+    parameter int IFU_ID_WIDTH
+) (
+    `AXI_S_PORT(sram, logic [31:0], logic [63:0], logic [7:0], logic [ID_WIDTH-1:0], logic, logic, logic,
+                logic, logic)
+    `AXI_S_PORT(ifu, logic [31:0], logic [63:0], logic [7:0], logic [IFU_ID_WIDTH-1:0], logic, logic,
+                logic, logic, logic)
+    input wire clk_i,
+    input wire rst_ni
+);
+  `AXI_TYPEDEF_ALL(axi, logic [31:0], logic [ID_WIDTH-1:0], logic [63:0], logic [7:0], logic)
+  `AXI_TYPEDEF_ALL(ifu_axi, logic [31:0], logic [IFU_ID_WIDTH-1:0], logic [63:0], logic [7:0], logic)
+  axi_req_t      axi_req;
+  axi_resp_t     axi_resp;
+  ifu_axi_req_t  ifu_req;
+  ifu_axi_resp_t ifu_resp;
+  `AXI_ASSIGN_SLAVE_TO_FLAT(sram, axi_req, axi_resp)
+  `AXI_ASSIGN_SLAVE_TO_FLAT(ifu, ifu_req, ifu_resp)
+
+  guineveer_sram #(
+      .MEM_SIZE  (MEM_SIZE),
+      .NUM_BANKS (NUM_BANKS),
+      .FETCH_PORT(1),
+      .FETCH_BASE(MEM_BASE),
+      .FETCH_ID_WIDTH(IFU_ID_WIDTH),
+      .DATA_WIDTH($bits(axi_req.w.data)),
+      .ID_WIDTH  ($bits(axi_req.aw.id)),
+      .AXI_AW_CHAN_T(axi_aw_chan_t),
+      .AXI_W_CHAN_T(axi_w_chan_t),
+      .AXI_B_CHAN_T(axi_b_chan_t),
+      .AXI_AR_CHAN_T(axi_ar_chan_t),
+      .AXI_R_CHAN_T(axi_r_chan_t),
+      .AXI_REQ_T (axi_req_t),
+      .AXI_RESP_T(axi_resp_t),
+      .FETCH_AW_CHAN_T(ifu_axi_aw_chan_t),
+      .FETCH_W_CHAN_T(ifu_axi_w_chan_t),
+      .FETCH_B_CHAN_T(ifu_axi_b_chan_t),
+      .FETCH_AR_CHAN_T(ifu_axi_ar_chan_t),
+      .FETCH_R_CHAN_T(ifu_axi_r_chan_t),
+      .FETCH_REQ_T(ifu_axi_req_t),
+      .FETCH_RESP_T(ifu_axi_resp_t),
+      .GUINEVEER_MEMORY_FILE(GUINEVEER_MEMORY_FILE)
+  ) xguineveer_sram (
+      .clk_i(clk_i),
+      .rst_ni(rst_ni),
+      .axi_req_i(axi_req),
+      .axi_resp_o(axi_resp),
+      .fetch_req_i(ifu_req),
+      .fetch_resp_o(ifu_resp)
+  );
+
+endmodule
@@ -7,6 +7,8 @@
 
 module sram_wrapper #(
     parameter string GUINEVEER_MEMORY_FILE = "",
+    parameter int MEM_SIZE = 'h10000,
+    parameter int NUM_BANKS = 1,
     parameter int ID_WIDTH
 ) (
     `AXI_S_PORT(sram, logic [31:0], logic [63:0], logic [7:0], logic [ID_WIDTH-1:0], logic, logic, logic,
@@ -20,9 +22,15 @@ module sram_wrapper #(
   `AXI_ASSIGN_SLAVE_TO_FLAT(sram, axi_req, axi_resp)
 
   guineveer_sram #(
-      .ADDR_WIDTH(16),
+      .MEM_SIZE  (MEM_SIZE),
+      .NUM_BANKS (NUM_BANKS),
       .DATA_WIDTH($bits(axi_req.w.data)),
       .ID_WIDTH  ($bits(axi_req.aw.id)),
+      .AXI_AW_CHAN_T(axi_aw_chan_t),
+      .AXI_W_CHAN_T(axi_w_chan_t),
+      .AXI_B_CHAN_T(axi_b_chan_t),
+      .AXI_AR_CHAN_T(axi_ar_chan_t),
+      .AXI_R_CHAN_T(axi_r_chan_t),
       .AXI_REQ_T (axi_req_t),
       .AXI_RESP_T(axi_resp_t),
       .GUINEVEER_MEMORY_FILE(GUINEVEER_MEMORY_FILE)
@@ -30,7 +38,9 @@ module sram_wrapper #(
       .clk_i(clk_i),
       .rst_ni(rst_ni),
       .axi_req_i(axi_req),
-      .axi_resp_o(axi_resp)
+      .axi_resp_o(axi_resp),
+      .fetch_req_i('0),
+      .fetch_resp_o()
   );
 
 endmodule
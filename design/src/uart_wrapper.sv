@@ -6,12 +6,15 @@
 // The reason for doing that is caused by this UART core using 32-bit registers
 // and allowing only 32-bit wide accesses, while the AXI-to-AHB bridge connected
 // before supports only 64-bit transactions on adresses aligned to 64-bits as well.
+// All UART interrupt outputs are combined into irq_o; the source is identified
+// by reading INTR_STATE.
 
 module uart_wrapper (
     input wire clk_i,
     input wire rst_ni,
     input wire uart_rx_i,
     output wire uart_tx_o,
+    output wire irq_o,
 
     input wire [31:0] haddr_i,
     input wire [2:0] hsize_i,
@@ -22,6 +25,19 @@ module uart_wrapper (
     output wire hresp_o
 );
 
+  wire intr_tx_watermark;
+  wire intr_rx_watermark;
+  wire intr_tx_empty;
+  wire intr_rx_overflow;
+  wire intr_rx_frame_err;
+  wire intr_rx_break_err;
+  wire intr_rx_timeout;
+  wire intr_rx_parity_err;
+
+  // The interrupt outputs are already masked by INTR_ENABLE.
+  assign irq_o = intr_tx_watermark | intr_rx_watermark | intr_tx_empty | intr_rx_overflow |
+                 intr_rx_frame_err | intr_rx_break_err | intr_rx_timeout | intr_rx_parity_err;
+
   uart #(
     .AHBAddrWidth(32),
     .AHBDataWidth(64)
@@ -43,16 +59,16 @@ module uart_wrapper (
     .hreadyout_o(),
 
     .alert_rx_i(),
-    .intr_rx_break_err_o(),
-    .intr_tx_empty_o(),
-    .intr_tx_watermark_o(),
+    .intr_rx_break_err_o(intr_rx_break_err),
+    .intr_tx_empty_o(intr_tx_empty),
+    .intr_tx_watermark_o(intr_tx_watermark),
     .cio_tx_en_o(),
-    .intr_rx_frame_err_o(),
-    .intr_rx_parity_err_o(),
-    .intr_rx_watermark_o(),
+    .intr_rx_frame_err_o(intr_rx_frame_err),
+    .intr_rx_parity_err_o(intr_rx_parity_err),
+    .intr_rx_watermark_o(intr_rx_watermark),
     .alert_tx_o(),
-    .intr_rx_timeout_o(),
-    .intr_rx_overflow_o()
+    .intr_rx_timeout_o(intr_rx_timeout),
+    .intr_rx_overflow_o(intr_rx_overflow)
   );
 
 endmodule
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+// Consoles of the firmware, one per core, fed with the characters written to
+// the core's mailbox.
+//
+// The characters are buffered here instead of being passed to $fwrite one by
+// one. Complete lines are echoed to stdout, with a prefix telling the cores
+// apart, and each log file is written in large blocks.
+
+#include <cstdio>
+#include <string>
+
+#include "Vguineveer_tb__Dpi.h"
+
+namespace {
+
+const size_t CONSOLE_BLOCK_SIZE = 64 * 1024;
+const int CONSOLE_MAX_STREAMS = 4;
+
+struct Stream {
+  FILE *file;
+  std::string prefix;
+  std::string buffer;
+  size_t line_start;
+
+  void echo() {
+    if (line_start == buffer.size()) return;
+
+    fputs(prefix.c_str(), stdout);
+    fwrite(buffer.data() + line_start, 1, buffer.size() - line_start, stdout);
+    fflush(stdout);
+    line_start = buffer.size();
+  }
+
+  void write_block() {
+    if (file) fwrite(buffer.data(), 1, buffer.size(), file);
+    buffer.clear();
+    line_start = 0;
+  }
+};
+
+Stream streams[CONSOLE_MAX_STREAMS];
+
+Stream *stream(int id) {
+  if (id < 0 || id >= CONSOLE_MAX_STREAMS) {
+    fprintf(stderr, "console: invalid stream %d\n", id);
+    return nullptr;
+  }
+  return &streams[id];
+}
+
+}  // namespace
+
+void console_open(int id, const char *path, const char *prefix) {
+  Stream *s = stream(id);
+  if (!s) return;
+
+  s->file = fopen(path, "w");
+  if (!s->file) perror(path);
+  s->prefix = prefix;
+  s->buffer.reserve(CONSOLE_BLOCK_SIZE);
+}
+
+void console_putc(int id, char c) {
+  Stream *s = stream(id);
+  if (!s) return;
+
+  s->buffer.push_back(c);
+  if (c != '\n') return;
+
+  s->echo();
+  if (s->buffer.size() >= CONSOLE_BLOCK_SIZE) s->write_block();
+}
+
+// Closes all streams. Safe to call more than once, e.g. before $fatal and again
+// from a final block.
+void console_close() {
+  for (Stream &s : streams) {
+    // Print the last line even if it isn't terminated.
+    s.echo();
+    s.write_block();
+    if (s.file) fclose(s.file);
+    s.file = nullptr;
+  }
+}
@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+// Firmware image loader of the testbench.
+//
+// image_load() reads a comma-separated list of images into chunks of bytes at
+// their physical addresses:
+//   - ELF files, every PT_LOAD segment at its p_paddr,
+//   - raw binaries, at the address given after '@' (e.g. payload.bin@0x80010000)
+//     or at the default address passed by the testbench.
+// The testbench then calls image_fill64()/image_fill32() for every memory, which
+// copy the part of the chunks falling into the memory straight into its array,
+// or image_fill_sparse() for memories kept in a SparseMemory.
+// image_unplaced() reports the bytes that didn't fall into any memory.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Vguineveer_tb__Dpi.h"
+#include "sparse_sram.h"
+
+namespace {
+
+const uint32_t PT_LOAD = 1;
+
+struct Chunk {
+  uint32_t addr;
+  std::vector<uint8_t> data;
+  size_t placed;
+};
+
+std::vector<Chunk> chunks;
+
+bool read_file(const std::string &path, std::vector<uint8_t> &contents) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) {
+    perror(path.c_str());
+    return false;
+  }
+
+  fseek(f, 0, SEEK_END);
+  contents.resize(ftell(f));
+  fseek(f, 0, SEEK_SET);
+  bool ok = fread(contents.data(), 1, contents.size(), f) == contents.size();
+  fclose(f);
+
+  if (!ok) fprintf(stderr, "%s: read error\n", path.c_str());
+  return ok;
+}
+
+uint32_t le32(const std::vector<uint8_t> &b, size_t off) {
+  return b[off] | b[off + 1] << 8 | b[off + 2] << 16 | (uint32_t)b[off + 3] << 24;
+}
+
+uint16_t le16(const std::vector<uint8_t> &b, size_t off) { return b[off] | b[off + 1] << 8; }
+
+bool load_elf(const std::string &path, const std::vector<uint8_t> &elf) {
+  // 32-bit, little-endian
+  if (elf.size() < 52 || elf[4] != 1 || elf[5] != 1) {
+    fprintf(stderr, "%s: expected a 32-bit little-endian ELF file\n", path.c_str());
+    return false;
+  }
+
+  uint32_t phoff = le32(elf, 28);
+  uint16_t phentsize = le16(elf, 42);
+  uint16_t phnum = le16(elf, 44);
+
+  for (uint16_t i = 0; i < phnum; i++) {
+    size_t ph = phoff + (size_t)i * phentsize;
+    if (ph + 32 > elf.size()) break;
+
+    uint32_t type = le32(elf, ph);
+    uint32_t offset = le32(elf, ph + 4);
+    uint32_t paddr = le32(elf, ph + 12);
+    uint32_t filesz = le32(elf, ph + 16);
+
+    if (type != PT_LOAD || !filesz) continue;
+    if ((size_t)offset + filesz > elf.size()) {
+      fprintf(stderr, "%s: segment %u is truncated\n", path.c_str(), i);
+      return false;
+    }
+
+    chunks.push_back({paddr, std::vector<uint8_t>(elf.begin() + offset,
+                                                  elf.begin() + offset + filesz), 0});
+  }
+
+  return true;
+}
+
+bool load_one(std::string spec, uint32_t default_addr) {
+  uint32_t addr = default_addr;
+  size_t at = spec.rfind('@');
+  if (at != std::string::npos) {
+    addr = strtoul(spec.c_str() + at + 1, nullptr, 0);
+    spec.resize(at);
+  }
+
+  std::vector<uint8_t> contents;
+  if (!read_file(spec, contents)) return false;
+
+  if (contents.size() >= 4 && !memcmp(contents.data(), "\x7f" "ELF", 4))
+    return load_elf(spec, contents);
+
+  chunks.push_back({addr, std::move(contents), 0});
+  return true;
+}
+
+// Calls place(chunk, start, end) for the part of every chunk falling into
+// [base, base + size) and counts the bytes as placed.
+template <typename F>
+void place_chunks(uint32_t base, uint64_t size, F place) {
+  for (Chunk &c : chunks) {
+    uint64_t start = c.addr > base ? c.addr : base;
+    uint64_t end = (uint64_t)c.addr + c.data.size();
+    if (end > base + size) end = base + size;
+    if (start >= end) continue;
+
+    place(c, start, end);
+    c.placed += end - start;
+  }
+}
+
+// Copies the bytes of every chunk in [base, base + words * word_bytes) to the
+// memory words, read-modify-write for words only partially covered.
+void fill(uint32_t base, int word_bytes, const svOpenArrayHandle mem) {
+  uint64_t size = (uint64_t)svSize(mem, 1) * word_bytes;
+  int lo = svLow(mem, 1);
+
+  place_chunks(base, size, [&](const Chunk &c, uint64_t start, uint64_t end) {
+    for (uint64_t addr = start; addr < end;) {
+      uint64_t offset = addr - base;
+      int index = lo + offset / word_bytes;
+      svBitVecVal word[2] = {0, 0};
+
+      svGetBitArrElem1VecVal(word, mem, index);
+      for (int lane = offset % word_bytes; lane < word_bytes && addr < end; lane++, addr++) {
+        svBitVecVal &half = word[lane / 4];
+        int shift = (lane % 4) * 8;
+        half = (half & ~(0xffu << shift)) | (uint32_t)c.data[addr - c.addr] << shift;
+      }
+      svPutBitArrElem1VecVal(mem, word, index);
+    }
+  });
+}
+
+}  // namespace
+
+int image_load(const char *spec, int default_addr) {
+  chunks.clear();
+
+  std::string list(spec);
+  size_t pos = 0;
+  while (pos <= list.size()) {
+    size_t comma = list.find(',', pos);
+    if (comma == std::string::npos) comma = list.size();
+
+    if (comma > pos && !load_one(list.substr(pos, comma - pos), default_addr)) return -1;
+    pos = comma + 1;
+  }
+
+  return 0;
+}
+
+void image_fill64(int base, const svOpenArrayHandle mem) { fill(base, 8, mem); }
+
+void image_fill32(int base, const svOpenArrayHandle mem) { fill(base, 4, mem); }
+
+void image_fill_sparse(int base, void *store) {
+  SparseMemory *mem = static_cast<SparseMemory *>(store);
+  place_chunks(base, mem->size(), [&](const Chunk &c, uint64_t start, uint64_t end) {
+    mem->write(start - base, c.data.data() + (start - c.addr), end - start);
+  });
+}
+
+int image_unplaced() {
+  int unplaced = 0;
+  for (const Chunk &c : chunks) {
+    if (c.placed == c.data.size()) continue;
+
+    fprintf(stderr, "image: 0x%zx bytes at 0x%08x are outside of the memories\n",
+            c.data.size() - c.placed, c.addr);
+    unplaced += c.data.size() - c.placed;
+  }
+
+  return unplaced;
+}
@@ -23,13 +23,21 @@ module guineveer_tb #(
     parameter int MAX_CYCLES = 100_000_000,
     `include "el2_param.vh"
 ) ();
+`ifdef DUALCORE
+  localparam int NumCores = 2;
+`else
+  localparam int NumCores = 1;
+`endif
+  localparam int Lmem0Base = 32'h8000_0000;
+  localparam int Lmem1Base = 32'h9000_0000;
+
   bit                         core_clk;
   bit                         i3c_clk;
   bit                         rst_l;
 
   bit    [              31:0] mem_signature_begin;
   bit    [              31:0] mem_signature_end;
-  bit    [              31:0] mem_mailbox;
+  bit    [              31:0] mem_mailbox            [NumCores];
   bit                         i_cpu_halt_req;
   bit                         o_cpu_halt_ack;
   bit                         o_cpu_halt_status;
@@ -76,11 +84,17 @@ module guineveer_tb #(
   logic                       jtag_tdi;
   logic                       jtag_trst_n;
 
-  logic                       mailbox_write;
-  logic  [              63:0] mailbox_data;
+  logic  [      NumCores-1:0] mailbox_write;
+  logic  [               7:0] mailbox_data           [NumCores];
+  logic  [      NumCores-1:0] mailbox_data_val;
+
+  // A core is active when firmware was loaded for it; the simulation ends once
+  // every active core has written its exit code to its mailbox.
+  bit    [      NumCores-1:0] core_active;
+  bit    [      NumCores-1:0] core_exited;
+  bit    [      NumCores-1:0] core_failed;
 
   int                         cycleCnt;
-  logic                       mailbox_data_val;
 
   int                         commit_count;
 
@@ -97,6 +111,7 @@ module guineveer_tb #(
   logic                       dmi_core_enable;
   string                      firmware0;
   string                      firmware1;
+  string                      ccm_file;
 
   always_comb dmi_core_enable = ~(o_cpu_halt_status);
 
@@ -104,13 +119,98 @@ module guineveer_tb #(
 
   `define DEC top_guineveer.rvtop_wrapper0.veer.dec
 
-  assign mailbox_write = top_guineveer.rvtop_wrapper0.lsu_axi_awvalid
-    && top_guineveer.rvtop_wrapper0.lsu_axi_awaddr == mem_mailbox && rst_l;
-  assign mailbox_data = top_guineveer.rvtop_wrapper0.lsu_axi_wdata;
+  // Each core has its own mailbox, snooped on its LSU bus. Stores to cacheable
+  // regions go out with the address aligned to the 64-bit bus, so the mailbox is
+  // matched on the bus word and the strobe of its byte lane, and the written
+  // byte is taken from that lane of the write data.
+  assign mailbox_write[0] = top_guineveer.rvtop_wrapper0.lsu_axi_awvalid
+    && top_guineveer.rvtop_wrapper0.lsu_axi_awaddr[31:3] == mem_mailbox[0][31:3]
+    && top_guineveer.rvtop_wrapper0.lsu_axi_wstrb[mem_mailbox[0][2:0]] && rst_l;
+  assign mailbox_data[0] = 8'(top_guineveer.rvtop_wrapper0.lsu_axi_wdata >>
+                              {mem_mailbox[0][2:0], 3'b000});
+`ifdef DUALCORE
+  `define DEC1 top_guineveer.rvtop_wrapper1.veer.dec
+
+  assign mailbox_write[1] = top_guineveer.rvtop_wrapper1.lsu_axi_awvalid
+    && top_guineveer.rvtop_wrapper1.lsu_axi_awaddr[31:3] == mem_mailbox[1][31:3]
+    && top_guineveer.rvtop_wrapper1.lsu_axi_wstrb[mem_mailbox[1][2:0]] && rst_l;
+  assign mailbox_data[1] = 8'(top_guineveer.rvtop_wrapper1.lsu_axi_wdata >>
+                              {mem_mailbox[1][2:0], 3'b000});
+`endif
+
+  for (genvar i = 0; i < NumCores; i++) begin : gen_mailbox_data_val
+    assign mailbox_data_val[i] = mailbox_data[i] > 8'h5 && mailbox_data[i] < 8'h7f;
+  end
+
+  // Firmware consoles, one per core, buffered in console.cpp
+  import "DPI-C" function void console_open(input int id, input string path, input string prefix);
+  import "DPI-C" function void console_putc(input int id, input byte c);
+  import "DPI-C" function void console_close();
+
+  // Firmware images, ELF files and raw binaries read by elf_loader.cpp
+  import "DPI-C" function int image_load(input string spec, input int default_addr);
+  import "DPI-C" function void image_fill64(input int base, inout bit [63:0] mem[]);
+  import "DPI-C" function void image_fill32(input int base, inout bit [31:0] mem[]);
+  import "DPI-C" function void image_fill_sparse(input int base, input chandle store);
+  import "DPI-C" function int image_unplaced();
+
+  // Loads the firmware of a core. Hex files are read into the core's memory with
+  // $readmemh, anything else is a comma-separated list of ELF files, placed by
+  // the physical addresses of their segments, and raw binaries, placed at the
+  // address after '@' or at the start of the core's memory. The CCMs are private
+  // to the core, so only its own are filled.
+  task automatic load_firmware(input int core, input string spec);
+    if (spec.len() > 4 && spec.substr(spec.len() - 4, spec.len() - 1) == ".hex") begin
+`ifdef GUINEVEER_SPARSE_SRAM
+      $fatal(1, "Hex firmware isn't supported with the sparse SRAM, use the ELF file: %s", spec);
+`else
+      if (core == 0) $readmemh(spec, top_guineveer.lmem0.xguineveer_sram.mem);
+`ifdef DUALCORE
+      else $readmemh(spec, top_guineveer.lmem1.xguineveer_sram.mem);
+`endif
+`endif
+      return;
+    end
+
+    if (image_load(spec, core == 0 ? Lmem0Base : Lmem1Base) != 0)
+      $fatal(1, "Failed to load the firmware of core %0d: %s", core, spec);
+
+`ifdef GUINEVEER_SPARSE_SRAM
+    image_fill_sparse(Lmem0Base, top_guineveer.lmem0.xguineveer_sram.backing());
+`ifdef DUALCORE
+    image_fill_sparse(Lmem1Base, top_guineveer.lmem1.xguineveer_sram.backing());
+`endif
+`else
+    image_fill64(Lmem0Base, top_guineveer.lmem0.xguineveer_sram.mem);
+`ifdef DUALCORE
+    image_fill64(Lmem1Base, top_guineveer.lmem1.xguineveer_sram.mem);
+`endif
+`endif
+
+    if (pt.ICCM_ENABLE && core == 0) begin
+      image_fill32(pt.ICCM_SADR, top_guineveer.rvtop_wrapper0.ccm_sram.iccm_image);
+      top_guineveer.rvtop_wrapper0.ccm_sram.write_iccm();
+    end
+    if (pt.DCCM_ENABLE && core == 0) begin
+      image_fill32(pt.DCCM_SADR, top_guineveer.rvtop_wrapper0.ccm_sram.dccm_image);
+      top_guineveer.rvtop_wrapper0.ccm_sram.write_dccm();
+    end
+`ifdef DUALCORE
+    if (pt.ICCM_ENABLE && core == 1) begin
+      image_fill32(pt.ICCM_SADR, top_guineveer.rvtop_wrapper1.ccm_sram.iccm_image);
+      top_guineveer.rvtop_wrapper1.ccm_sram.write_iccm();
+    end
+    if (pt.DCCM_ENABLE && core == 1) begin
+      image_fill32(pt.DCCM_SADR, top_guineveer.rvtop_wrapper1.ccm_sram.dccm_image);
+      top_guineveer.rvtop_wrapper1.ccm_sram.write_dccm();
+    end
+`endif
 
-  assign mailbox_data_val = mailbox_data[7:0] > 8'h5 && mailbox_data[7:0] < 8'h7f;
+    if (image_unplaced() != 0)
+      $fatal(1, "The firmware of core %0d doesn't fit in the memories: %s", core, spec);
+  endtask
 
-  integer fd, tp, el;
+  integer tp, el;
   logic next_dbus_error;
   logic next_ibus_error;
 
@@ -129,28 +229,45 @@ module guineveer_tb #(
       extintsrc_req[1] <= 0;
       // timeout monitor
       if (cycleCnt == MAX_CYCLES) begin
+        console_close();
         $display("Hit max cycle count (%0d) .. stopping", cycleCnt);
         $display("TEST_FAILED");
         $fatal;
       end
-      // console Monitor
-      if (mailbox_data_val & mailbox_write) begin
-        $fwrite(fd, "%c", mailbox_data[7:0]);
-        $write("%c", mailbox_data[7:0]);
+      // console monitor and exit codes, 0xff - success, 0x1 - failure
+      for (int i = 0; i < NumCores; i++) begin
+        if (mailbox_write[i] && mailbox_data_val[i]) console_putc(i, mailbox_data[i]);
+
+        if (mailbox_write[i] && !core_exited[i] &&
+            (mailbox_data[i] == 8'hff || mailbox_data[i] == 8'h1)) begin
+          core_exited[i] <= 1;
+          core_failed[i] <= mailbox_data[i] == 8'h1;
+        end
       end
 
-      if (mailbox_write && mailbox_data[7:0] == 8'hff) begin
+      if ((core_exited & core_active) == core_active) begin
+        console_close();
+        for (int i = 0; i < NumCores; i++)
+          if (core_active[i]) $display("Core %0d: %s", i, core_failed[i] ? "failed" : "passed");
+
+        if (|(core_failed & core_active)) begin
+          $display("TEST_FAILED");
+          $fatal;
+        end
+
         $display("\nFinished : minstret = %0d, mcycle = %0d", `DEC.tlu.minstretl[31:0],
                  `DEC.tlu.mcyclel[31:0]);
+`ifdef DUALCORE
+        if (core_active[1])
+          $display("Core 1   : minstret = %0d, mcycle = %0d", `DEC1.tlu.minstretl[31:0],
+                   `DEC1.tlu.mcyclel[31:0]);
+`endif
         $display("See \"exec.log\" for execution trace with register updates..\n");
         $display("VerilatorTB: End of sim\n");
         // OpenOCD test breaks if simulation closes the TCP connection first.
         // This delay allows OpenOCD to close the connection before the #finish.
         #15000;
         $finish(0);
-      end else if (mailbox_write && mailbox_data[7:0] == 8'h1) begin
-        $display("TEST_FAILED");
-        $fatal;
       end
     end
   end
@@ -203,9 +320,12 @@ module guineveer_tb #(
     $display("\nVerilatorTB: Start of sim\n");
     mem_signature_begin = '0;
     mem_signature_end = '0;
-    mem_mailbox = 'h80f80000;
-
-    $display("mem_mailbox = %x", mem_mailbox);
+    // Keep in sync with MAILBOX in the crt0.s files, every mailbox has a bus
+    // word of its own
+    for (int i = 0; i < NumCores; i++) begin
+      mem_mailbox[i] = 'h80f80000 + 8 * i;
+      $display("mem_mailbox[%0d] = %x", i, mem_mailbox[i]);
+    end
 
     abi_reg[0]     = "zero";
     abi_reg[1]     = "ra";
@@ -253,21 +373,39 @@ module guineveer_tb #(
     nmi_vector     = 32'hee000000;
     lsu_bus_clk_en = 1;
 
-    if ($value$plusargs("firmware0=%s", firmware0)) begin
-      $readmemh(firmware0, top_guineveer.lmem0.xguineveer_sram.mem);
-    end
-    
+    // Core 0 is always active, its memory may also be preloaded by other means.
+    core_active[0] = 1;
+    if ($value$plusargs("firmware0=%s", firmware0)) load_firmware(0, firmware0);
+
 `ifdef DUALCORE
     if ($value$plusargs("firmware1=%s", firmware1)) begin
-      $readmemh(firmware1, top_guineveer.lmem1.xguineveer_sram.mem);
+      load_firmware(1, firmware1);
+      core_active[1] = 1;
     end
 `endif
 
+    // Closely coupled memories of the perf profile, see veer_ccm_sram.sv. Only
+    // needed with hex firmware, ELF files already hold the CCM sections.
+    if ($value$plusargs("iccm0=%s", ccm_file))
+      top_guineveer.rvtop_wrapper0.ccm_sram.load_iccm(ccm_file);
+    if ($value$plusargs("dccm0=%s", ccm_file))
+      top_guineveer.rvtop_wrapper0.ccm_sram.load_dccm(ccm_file);
+`ifdef DUALCORE
+    if ($value$plusargs("iccm1=%s", ccm_file))
+      top_guineveer.rvtop_wrapper1.ccm_sram.load_iccm(ccm_file);
+    if ($value$plusargs("dccm1=%s", ccm_file))
+      top_guineveer.rvtop_wrapper1.ccm_sram.load_dccm(ccm_file);
+`endif
+
     tp = $fopen("trace_port.csv", "w");
     el = $fopen("exec.log", "w");
     $fwrite(el,
             "//   Cycle : #inst    0    pc    opcode    reg=value    csr=value     ; mnemonic\n");
-    fd = $fopen("console.log", "w");
+    // console.log keeps the output of core 0, the other cores get their own file
+    // and, in the dualcore design, a prefix on stdout.
+    for (int i = 0; i < NumCores; i++)
+      console_open(i, i == 0 ? "console.log" : $sformatf("console%0d.log", i),
+                   NumCores > 1 ? $sformatf("[CORE%0d]: ", i) : "");
     commit_count = 0;
   end
   assign rst_l = cycleCnt > 2;
@@ -305,6 +443,8 @@ module guineveer_tb #(
     end
   end
 
+  final console_close();
+
   final if (line_buffer.len() > 0) $display("[UART MONITOR]: %s", line_buffer);
 
   guineveer top_guineveer (
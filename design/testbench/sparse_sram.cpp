@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+// DPI side of guineveer_sram built with GUINEVEER_SPARSE_SRAM. Each memory is
+// a SparseMemory addressed here by the index of its 64-bit words. Without
+// GUINEVEER_SPARSE_SRAM the functions are simply unused.
+
+#include <cstdint>
+
+#include "Vguineveer_tb__Dpi.h"
+#include "sparse_sram.h"
+
+void *sparse_sram_new(int size) { return new SparseMemory(size); }
+
+long long sparse_sram_read(void *store, int word) {
+  SparseMemory *mem = static_cast<SparseMemory *>(store);
+  uint32_t addr = (uint32_t)word * 8;
+  const uint8_t *page = mem->page(addr, false);
+  if (!page) return 0;
+
+  uint64_t data = 0;
+  for (int i = 7; i >= 0; i--) data = data << 8 | page[addr % SparseMemory::PAGE_SIZE + i];
+  return data;
+}
+
+void sparse_sram_write(void *store, int word, long long data, char strb) {
+  SparseMemory *mem = static_cast<SparseMemory *>(store);
+  uint32_t addr = (uint32_t)word * 8;
+  uint8_t *page = mem->page(addr, true) + addr % SparseMemory::PAGE_SIZE;
+
+  for (int i = 0; i < 8; i++)
+    if (strb >> i & 1) page[i] = (uint64_t)data >> (8 * i);
+}
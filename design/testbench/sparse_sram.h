@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+// Sparse memory backing guineveer_sram in simulations defining
+// GUINEVEER_SPARSE_SRAM. Pages are allocated, zeroed, on their first write;
+// reading a page that was never written returns zeros.
+
+#ifndef SPARSE_SRAM_H
+#define SPARSE_SRAM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+class SparseMemory {
+ public:
+  static const int PAGE_BITS = 12;
+  static const uint32_t PAGE_SIZE = 1u << PAGE_BITS;
+
+  explicit SparseMemory(uint32_t size) : size_(size) {}
+
+  uint32_t size() const { return size_; }
+
+  // Returns the page holding addr, or nullptr if it wasn't allocated and
+  // allocate is false.
+  uint8_t *page(uint32_t addr, bool allocate) {
+    uint32_t index = addr >> PAGE_BITS;
+    if (last_page_ && last_index_ == index) return last_page_;
+
+    auto it = pages_.find(index);
+    if (it == pages_.end()) {
+      if (!allocate) return nullptr;
+      it = pages_.emplace(index, std::unique_ptr<uint8_t[]>(new uint8_t[PAGE_SIZE]())).first;
+    }
+
+    last_index_ = index;
+    last_page_ = it->second.get();
+    return last_page_;
+  }
+
+  void write(uint32_t addr, const uint8_t *data, size_t len) {
+    while (len) {
+      uint32_t offset = addr % PAGE_SIZE;
+      size_t chunk = PAGE_SIZE - offset < len ? PAGE_SIZE - offset : len;
+      std::copy(data, data + chunk, page(addr, true) + offset);
+      addr += chunk;
+      data += chunk;
+      len -= chunk;
+    }
+  }
+
+ private:
+  uint32_t size_;
+  std::unordered_map<uint32_t, std::unique_ptr<uint8_t[]>> pages_;
+  uint32_t last_index_ = 0;
+  uint8_t *last_page_ = nullptr;
+};
+
+#endif
@@ -0,0 +1,126 @@
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+// SPDX-License-Identifier: Apache-2.0
+
+// ICCM and DCCM banks of a VeeR EL2 core.
+//
+// The core only exports the ports of its closely coupled memories through
+// el2_mem_export, the RAMs themselves have to be provided outside of it. This
+// module is bound into every el2_veer_wrapper instance and provides them when
+// the VeeR configuration enables them (PROFILE=perf in the root Makefile).
+// It is a simulation model, so it is only part of the testbench sources.
+// Each bank word keeps the 7 ECC bits generated by the core above the data.
+//
+// The core can't store to its ICCM, so the testbench preloads both memories,
+// either with load_iccm()/load_dccm() from hex files of 32-bit words made by
+// objcopy -O verilog, with addresses relative to the start of the memory, or by
+// filling iccm_image/dccm_image itself and calling write_iccm()/write_dccm().
+
+module veer_ccm_sram
+  import el2_pkg::*;
+#(
+    `include "el2_param.vh"
+) (
+    el2_mem_if el2_mem_export
+);
+  localparam int EccWidth = 7;
+  localparam int WordWidth = 32 + EccWidth;
+
+  localparam int IccmBanks = pt.ICCM_ENABLE ? pt.ICCM_NUM_BANKS : 1;
+  localparam int IccmDepth = pt.ICCM_ENABLE ? pt.ICCM_INDEX_DEPTH : 1;
+  localparam int IccmWords = pt.ICCM_ENABLE ? pt.ICCM_SIZE * 256 : 1;
+  localparam int DccmBanks = pt.DCCM_ENABLE ? pt.DCCM_NUM_BANKS : 1;
+  localparam int DccmDepth = pt.DCCM_ENABLE ? pt.DCCM_INDEX_DEPTH : 1;
+  localparam int DccmWords = pt.DCCM_ENABLE ? pt.DCCM_SIZE * 256 : 1;
+
+  logic [WordWidth-1:0] iccm     [IccmBanks][IccmDepth];
+  logic [WordWidth-1:0] iccm_dout[IccmBanks];
+  logic [WordWidth-1:0] dccm     [DccmBanks][DccmDepth];
+  logic [WordWidth-1:0] dccm_dout[DccmBanks];
+
+  bit   [         31:0] iccm_image[IccmWords];
+  bit   [         31:0] dccm_image[DccmWords];
+
+  // Same as the encoder used by the core, see el2_lib.sv (rvecc_encode).
+  function automatic logic [EccWidth-1:0] ecc32(input logic [31:0] data);
+    logic [EccWidth-1:0] ecc;
+    ecc[0] = ^(data & 32'h56aa_ad5b);
+    ecc[1] = ^(data & 32'h9b33_366d);
+    ecc[2] = ^(data & 32'he3c3_c78e);
+    ecc[3] = ^(data & 32'h03fc_07f0);
+    ecc[4] = ^(data & 32'h03ff_f800);
+    ecc[5] = ^(data & 32'hfc00_0000);
+    ecc[6] = ^{data, ecc[5:0]};
+    return ecc;
+  endfunction
+
+  if (pt.ICCM_ENABLE) begin : gen_iccm
+    always @(posedge el2_mem_export.clk) begin
+      for (int i = 0; i < IccmBanks; i++) begin
+        if (el2_mem_export.iccm_clken[i]) begin
+          if (el2_mem_export.iccm_wren_bank[i])
+            iccm[i][el2_mem_export.iccm_addr_bank[i]] <= {
+              el2_mem_export.iccm_bank_wr_ecc[i], el2_mem_export.iccm_bank_wr_data[i]
+            };
+          iccm_dout[i] <= iccm[i][el2_mem_export.iccm_addr_bank[i]];
+        end
+      end
+    end
+
+    for (genvar i = 0; i < IccmBanks; i++) begin : gen_bank
+      assign {el2_mem_export.iccm_bank_ecc[i], el2_mem_export.iccm_bank_dout[i]} = iccm_dout[i];
+    end
+  end
+
+  if (pt.DCCM_ENABLE) begin : gen_dccm
+    always @(posedge el2_mem_export.clk) begin
+      for (int i = 0; i < DccmBanks; i++) begin
+        if (el2_mem_export.dccm_clken[i]) begin
+          if (el2_mem_export.dccm_wren_bank[i])
+            dccm[i][el2_mem_export.dccm_addr_bank[i]] <= {
+              el2_mem_export.dccm_wr_ecc_bank[i], el2_mem_export.dccm_wr_data_bank[i]
+            };
+          dccm_dout[i] <= dccm[i][el2_mem_export.dccm_addr_bank[i]];
+        end
+      end
+    end
+
+    for (genvar i = 0; i < DccmBanks; i++) begin : gen_bank
+      assign {el2_mem_export.dccm_bank_ecc[i], el2_mem_export.dccm_bank_dout[i]} = dccm_dout[i];
+    end
+  end
+
+  // Words are interleaved between the banks, the lowest bits of the word address
+  // select the bank.
+  task automatic load_iccm(input string file);
+    if (!pt.ICCM_ENABLE) begin
+      $error("%m: ICCM is not enabled in the VeeR configuration");
+      return;
+    end
+
+    $readmemh(file, iccm_image);
+    write_iccm();
+  endtask
+
+  task automatic write_iccm();
+    for (int i = 0; i < IccmWords; i++)
+      iccm[i%IccmBanks][i/IccmBanks] <= {ecc32(iccm_image[i]), iccm_image[i]};
+  endtask
+
+  task automatic load_dccm(input string file);
+    if (!pt.DCCM_ENABLE) begin
+      $error("%m: DCCM is not enabled in the VeeR configuration");
+      return;
+    end
+
+    $readmemh(file, dccm_image);
+    write_dccm();
+  endtask
+
+  task automatic write_dccm();
+    for (int i = 0; i < DccmWords; i++)
+      dccm[i%DccmBanks][i/DccmBanks] <= {ecc32(dccm_image[i]), dccm_image[i]};
+  endtask
+
+endmodule
+
+bind el2_veer_wrapper veer_ccm_sram #(.pt(pt)) ccm_sram (.el2_mem_export(el2_mem_export));
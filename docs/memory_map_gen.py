@@ -42,8 +42,10 @@ def design_component_to_mmap_name(name: str) -> str:
     return {
         "lmem0": "Memory for core 0",
         "lmem1": "Memory for core 1",
+        "shmem": "Memory shared by the cores",
         "axi_bridge": "UART",
         "i_axi_cdc_lsu": "I3C core",
+        "ipc": "Inter-core semaphores and doorbells",
     }[name]
 
 
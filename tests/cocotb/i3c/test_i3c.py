@@ -4,12 +4,23 @@
 import cocotb
 from cocotb.handle import HierarchyObject
 from cocotb.triggers import ClockCycles
+from cocotb.utils import get_sim_time
 from util import begin_test, read_line, setup
 
 EMPTY_ADDR = 0x00
 STATIC_ADDR = 0x5A
 DYNAMIC_ADDR = 0x52
 
+ECHO_MSG_COUNT = 16
+ECHO_MSG_LEN = 8
+
+STREAM_MSG_COUNT = 16
+STREAM_MSG_LEN = 8
+
+COPY_BENCH_LEN = 64
+
+echo_rates = {}
+
 
 @cocotb.test
 async def test_unknown(dut: HierarchyObject):
@@ -73,6 +84,133 @@ async def test_read_write(dut: HierarchyObject):
     assert recv_data.data == bytes(test_data)
 
 
+async def run_echo(dut: HierarchyObject, test_case: str) -> float:
+    """
+    Bounce ECHO_MSG_COUNT private transfers off the CPU and return the achieved
+    rate in messages per second of simulated time.
+    """
+
+    i3c_ctrl, uart_sink, uart_source = await setup(dut)
+
+    await begin_test(uart_sink, uart_source, test_case)
+
+    retries = 0
+    start = get_sim_time("ns")
+
+    for i in range(ECHO_MSG_COUNT):
+        test_data = [(i * ECHO_MSG_LEN + j) & 0xFF for j in range(ECHO_MSG_LEN)]
+        await i3c_ctrl.i3c_write(STATIC_ADDR, test_data)
+
+        # The read is NACKed until the firmware has staged the response.
+        while True:
+            recv_data = await i3c_ctrl.i3c_read(STATIC_ADDR, ECHO_MSG_LEN)
+            if not recv_data.nack:
+                break
+            retries += 1
+
+        assert recv_data.data == bytes(test_data)
+
+    elapsed = get_sim_time("ns") - start
+
+    line = await read_line(uart_sink)
+    assert line == "done"
+
+    rate = ECHO_MSG_COUNT / (elapsed * 1e-9)
+    dut._log.info(f"{test_case}: {rate:.0f} msg/s, {retries} NACKed reads")
+
+    return rate
+
+
+@cocotb.test
+async def test_echo_polled(dut: HierarchyObject):
+    """
+    Measure the private transfer echo rate of the polled TTI path.
+    """
+
+    echo_rates["polled"] = await run_echo(dut, "3")
+
+
+@cocotb.test
+async def test_echo_irq(dut: HierarchyObject):
+    """
+    Measure the private transfer echo rate of the interrupt-driven TTI driver.
+    """
+
+    echo_rates["irq"] = await run_echo(dut, "4")
+
+    if "polled" in echo_rates:
+        dut._log.info(
+            f"Interrupt-driven rate is {echo_rates['irq'] / echo_rates['polled']:.2f}x polled"
+        )
+
+
+@cocotb.test
+async def test_stream_irq(dut: HierarchyObject):
+    """
+    Test whether the interrupt-driven TTI driver keeps the TX queues topped up
+    while more messages are queued than the TTI holds, so that back-to-back
+    reads are not NACKed once the first message is staged.
+    """
+
+    i3c_ctrl, uart_sink, uart_source = await setup(dut)
+
+    await begin_test(uart_sink, uart_source, "6")
+
+    retries = 0
+
+    for i in range(STREAM_MSG_COUNT):
+        expected = [(i * STREAM_MSG_LEN + j) & 0xFF for j in range(STREAM_MSG_LEN)]
+
+        while True:
+            recv_data = await i3c_ctrl.i3c_read(STATIC_ADDR, STREAM_MSG_LEN)
+            if not recv_data.nack:
+                break
+            # Only the first read may come before the firmware has staged anything.
+            assert i == 0, f"read of message {i} NACKed"
+            retries += 1
+
+        assert recv_data.data == bytes(expected)
+
+    line = await read_line(uart_sink)
+    assert line == "done"
+
+    dut._log.info(f"stream: {STREAM_MSG_COUNT} messages, {retries} NACKed reads before the first")
+
+
+@cocotb.test
+async def test_copy_bench(dut: HierarchyObject):
+    """
+    Measure the cycle cost of the TTI data copy loops for a word-aligned buffer
+    (word-burst path) and a misaligned one (byte path).
+    """
+
+    i3c_ctrl, uart_sink, uart_source = await setup(dut)
+
+    await begin_test(uart_sink, uart_source, "5")
+
+    for i in range(2):
+        test_data = [(i * 0x40 + j * 7) & 0xFF for j in range(COPY_BENCH_LEN)]
+        await i3c_ctrl.i3c_write(STATIC_ADDR, test_data)
+
+        while True:
+            recv_data = await i3c_ctrl.i3c_read(STATIC_ADDR, COPY_BENCH_LEN)
+            if not recv_data.nack:
+                break
+
+        assert recv_data.data == bytes(test_data)
+
+    line = await read_line(uart_sink)
+    rx_word, rx_byte, tx_word, tx_byte = (int(v) for v in line.split())
+
+    dut._log.info(
+        f"{COPY_BENCH_LEN} B copy, word/byte path: "
+        f"RX {rx_word}/{rx_byte} cycles, TX {tx_word}/{tx_byte} cycles"
+    )
+
+    assert rx_word < rx_byte
+    assert tx_word < tx_byte
+
+
 @cocotb.test
 async def test_ccc_getpid(dut: HierarchyObject):
     """
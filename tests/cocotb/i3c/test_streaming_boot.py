@@ -2,11 +2,16 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import cocotb
+import os
+import re
 import struct
 
 from cocotb.triggers import Timer
 from cocotb.handle import HierarchyObject
+from cocotb.utils import get_sim_time
 from cocotbext_i3c.i3c_recovery_interface import I3cRecoveryInterface
+from mkbootimage import build_image, load_segments
+from pathlib import Path
 from util import begin_test, read_line, setup, timeout_task
 
 STATIC_ADDR = 0x5A
@@ -54,6 +59,33 @@ RECOVERY_IMAGE = [
     *[ord(x) for x in "Hello from I3C streaming boot image.\r\n"], 0x00, 0x00
 ]
 
+# Size of the filler segment, taken from the code of the firmware under test so
+# that it compresses like a real image does.
+FILLER_SIZE = 0x2000
+
+
+def firmware_filler() -> bytes:
+    """
+    Returns the first FILLER_SIZE bytes of the loadable contents of the
+    firmware ELF file the simulation runs, see FIRMWARE_ELF0 in the Makefile.
+    """
+
+    _, segments = load_segments(Path(os.environ["FIRMWARE_ELF0"]).read_bytes())
+    return b"".join(contents for _, contents, _ in segments)[:FILLER_SIZE]
+
+
+# Loaded into the upper part of lmem0, the filler segment makes the transfer
+# long enough for the receive time to be meaningful.
+SEGMENTED_IMAGE_LOAD_ADDR = 0x80010000
+SEGMENTED_IMAGE_FILLER = firmware_filler()
+SEGMENTED_IMAGE_SEGMENTS = [
+    (SEGMENTED_IMAGE_LOAD_ADDR, bytes(RECOVERY_IMAGE), len(RECOVERY_IMAGE)),
+    (0x80011000, SEGMENTED_IMAGE_FILLER, len(SEGMENTED_IMAGE_FILLER)),
+]
+
+boot_cycles = {}
+boot_times = {}
+
 FIFO_EMPTY_FLAG = 1 << 0
 FIFO_FULL_FLAG = 1 << 0
 
@@ -78,6 +110,21 @@ PROT_CAP_PUSH_C_IMAGE = 1 << 7
 PROT_CAP_FLASHLESS_BOOT = 1 << 11
 
 
+async def read_receive_time(dut: HierarchyObject, uart_sink) -> int:
+    """
+    Parse and log the receive time reported by the firmware before it boots the image.
+    """
+
+    line = await read_line(uart_sink)
+    match = re.fullmatch(r"Received (\d+) B in (\d+) cycles", line)
+    assert match, f"Unexpected line: {line!r}"
+
+    size, cycles = int(match[1]), int(match[2])
+    dut._log.info(f"Received {size} B recovery image in {cycles} cycles")
+
+    return cycles
+
+
 async def fifo_wait_for_space(recovery: I3cRecoveryInterface) -> int:
     while True:
         resp, ok = await recovery.command_read(
@@ -98,16 +145,16 @@ async def fifo_wait_for_space(recovery: I3cRecoveryInterface) -> int:
         await Timer(100, units="us")
 
 
-@cocotb.test
-async def test_i3c_streaming_boot(dut: HierarchyObject):
+async def recovery_boot(dut: HierarchyObject, test_case: str, image: list[int]):
     """
-    Test whether I3C streaming boot works.
+    Push an image through the I3C recovery interface and request booting it.
+    Returns the final recovery status and the UART sink.
     """
 
     i3c_ctrl, uart_sink, uart_source = await setup(dut)
     recovery = I3cRecoveryInterface(i3c_ctrl)
 
-    await begin_test(uart_sink, uart_source, "B")
+    await begin_test(uart_sink, uart_source, test_case)
 
     cocotb.start_soon(timeout_task(5))
 
@@ -168,7 +215,7 @@ async def test_i3c_streaming_boot(dut: HierarchyObject):
     await recovery.command_write(
         VIRT_DYNAMIC_ADDR,
         I3cRecoveryInterface.Command.INDIRECT_FIFO_CTRL,
-        data=struct.pack("<BBI", 0, 0, (len(RECOVERY_IMAGE) + 3) // 4),
+        data=struct.pack("<BBI", 0, 0, (len(image) + 3) // 4),
     )
 
     # Make sure the image is not too large.
@@ -188,12 +235,12 @@ async def test_i3c_streaming_boot(dut: HierarchyObject):
 
     # Write recovery image.
     progress = 0
-    while progress < len(RECOVERY_IMAGE):
+    while progress < len(image):
         # Wait for space in FIFO.
         fifo_free = await fifo_wait_for_space(recovery)
 
-        chunk_size = min(len(RECOVERY_IMAGE) - progress, xfer_size, fifo_free)
-        chunk = RECOVERY_IMAGE[progress : progress + chunk_size]
+        chunk_size = min(len(image) - progress, xfer_size, fifo_free)
+        chunk = image[progress : progress + chunk_size]
 
         await recovery.command_write(
             VIRT_DYNAMIC_ADDR, I3cRecoveryInterface.Command.INDIRECT_FIFO_DATA, data=chunk
@@ -214,16 +261,104 @@ async def test_i3c_streaming_boot(dut: HierarchyObject):
         assert ok
 
         if resp[0] == RECOVERY_STATUS_SUCCESS or resp[0] == RECOVERY_STATUS_FAILURE:
-            assert resp[0] != RECOVERY_STATUS_FAILURE
-            break
+            return resp[0], uart_sink
 
         await Timer(100, units="us")
 
+
+@cocotb.test
+async def test_i3c_streaming_boot(dut: HierarchyObject):
+    """
+    Test whether I3C streaming boot works.
+    """
+
+    status, uart_sink = await recovery_boot(dut, "B", RECOVERY_IMAGE)
+    assert status == RECOVERY_STATUS_SUCCESS
+
+    await read_receive_time(dut, uart_sink)
+
     # Wait for a message from the booted image.
     line = await read_line(uart_sink)
     assert line == "Hello from I3C streaming boot image."
 
 
+async def run_segmented_boot(dut: HierarchyObject, crc32: bool = False, lzss: bool = False):
+    """
+    Boot a segmented image with the library receiver. Returns its receive time in
+    cycles and the time from the start of the test to the booted image's output in ns.
+    """
+
+    image = build_image(SEGMENTED_IMAGE_LOAD_ADDR, SEGMENTED_IMAGE_SEGMENTS, crc32, lzss)
+    start = get_sim_time("ns")
+
+    status, uart_sink = await recovery_boot(dut, "C", list(image))
+    assert status == RECOVERY_STATUS_SUCCESS
+
+    cycles = await read_receive_time(dut, uart_sink)
+
+    line = await read_line(uart_sink)
+    assert line == "Hello from I3C streaming boot image."
+
+    boot_time = get_sim_time("ns") - start
+    dut._log.info(f"{len(image)} B image booted in {boot_time / 1000:.1f} us")
+
+    return cycles, boot_time
+
+
+@cocotb.test
+async def test_segmented_streaming_boot(dut: HierarchyObject):
+    """
+    Test whether a segmented image without an integrity check is scatter-loaded and booted.
+    """
+
+    boot_cycles["raw"], boot_times["raw"] = await run_segmented_boot(dut)
+
+
+@cocotb.test
+async def test_segmented_streaming_boot_crc32(dut: HierarchyObject):
+    """
+    Test whether a segmented image with a CRC-32 trailer boots, and measure the cost of the check.
+    """
+
+    boot_cycles["crc32"], boot_times["crc32"] = await run_segmented_boot(dut, crc32=True)
+
+    if "raw" in boot_cycles:
+        overhead = boot_cycles["crc32"] - boot_cycles["raw"]
+        dut._log.info(
+            f"CRC-32 check adds {overhead} cycles "
+            f"({overhead / boot_cycles['raw'] * 100:.1f}%) to the image receive time"
+        )
+
+
+@cocotb.test
+async def test_segmented_streaming_boot_lzss(dut: HierarchyObject):
+    """
+    Test whether a compressed segmented image is decompressed while it streams in,
+    and compare its total boot time with the uncompressed one, both with a CRC-32 trailer.
+    """
+
+    _, boot_times["lzss"] = await run_segmented_boot(dut, crc32=True, lzss=True)
+
+    if "crc32" in boot_times:
+        dut._log.info(
+            f"Compressed image boots in {boot_times['lzss'] / boot_times['crc32'] * 100:.1f}% "
+            "of the uncompressed boot time"
+        )
+
+
+@cocotb.test
+async def test_segmented_streaming_boot_bad_crc32(dut: HierarchyObject):
+    """
+    Test whether a segmented image with a corrupted payload is rejected.
+    """
+
+    image = list(build_image(SEGMENTED_IMAGE_LOAD_ADDR, SEGMENTED_IMAGE_SEGMENTS, crc32=True))
+    image[-8] ^= 0xFF
+
+    status, _ = await recovery_boot(dut, "C", image)
+    assert status == RECOVERY_STATUS_FAILURE
+
+
 @cocotb.test
 async def test_axi_streaming_boot(dut: HierarchyObject):
     """
@@ -238,6 +373,8 @@ async def test_axi_streaming_boot(dut: HierarchyObject):
 
     # AXI streaming boot is mostly driven by the firmware, so we don't have much to do here.
 
+    await read_receive_time(dut, uart_sink)
+
     # Wait for a message from the booted image.
     line = await read_line(uart_sink)
     assert line == "Hello from AXI streaming boot image."
@@ -0,0 +1,60 @@
+# Copyright (c) 2026 Antmicro <www.antmicro.com>
+# SPDX-License-Identifier: Apache-2.0
+
+import re
+import zlib
+
+import cocotb
+from cocotb.handle import HierarchyObject
+from cocotbext.uart import UartSink, UartSource
+from util import begin_test, read_line, setup, timeout_task
+
+UART_STRESS_BAUD = 921600
+UART_STRESS_LINE_LEN = 32
+UART_STRESS_LINES = 16
+
+RESULT_RE = r"Received (\d+) B in (\d+) lines, CRC ([0-9a-f]{8}), (\d+) overflows"
+
+
+@cocotb.test
+async def test_uart_irq_stress(dut: HierarchyObject):
+    """
+    Stream lines at 921600 baud while the core is busy and check that the
+    interrupt-driven UART driver receives every byte. The last line has no
+    newline and is only completed by the RX timeout.
+    """
+
+    cocotb.start_soon(timeout_task(20))
+
+    i3c_ctrl, uart_sink, uart_source = await setup(dut)
+
+    await begin_test(uart_sink, uart_source, "U")
+
+    line = await read_line(uart_sink)
+    assert line == f"Switching to {UART_STRESS_BAUD} baud"
+
+    uart_sink = UartSink(dut.uart_tx_o, baud=UART_STRESS_BAUD)
+    uart_source = UartSource(dut.uart_rx_i, baud=UART_STRESS_BAUD)
+
+    line = await read_line(uart_sink)
+    assert line == "Ready"
+
+    data = bytearray()
+    for i in range(UART_STRESS_LINES):
+        text = bytes((0x21 + (i * 7 + j) % 94) for j in range(UART_STRESS_LINE_LEN - 1))
+        data += text + (b"\n" if i < UART_STRESS_LINES - 1 else text[-1:])
+
+    await uart_source.write(data)
+    await uart_source.wait()
+
+    line = await read_line(uart_sink)
+    dut._log.info(line)
+
+    match = re.fullmatch(RESULT_RE, line)
+    assert match is not None
+
+    received, lines, crc, overflows = match.groups()
+    assert int(received) == len(data)
+    assert int(lines) == UART_STRESS_LINES
+    assert int(crc, 16) == zlib.crc32(data)
+    assert int(overflows) == 0
@@ -1,6 +1,7 @@
 # Copyright (c) 2025-2026 Antmicro <www.antmicro.com>
 # SPDX-License-Identifier: Apache-2.0
 
+import cocotb
 from cocotb.clock import Clock
 from cocotb.handle import HierarchyObject
 from cocotb.triggers import ClockCycles, Timer
@@ -9,12 +10,22 @@ from cocotbext_i3c.i3c_controller import I3cController
 
 
 async def read_line(uart_sink: UartSink) -> str:
-    buf = list[int]()
+    """
+    Reads a line from the UART. Performance counter dumps of tests/sw/libs/perf
+    ("@P" lines) are logged and skipped.
+    """
 
-    while not buf or buf[-1] != ord("\n"):
-        buf += await uart_sink.read(count=1)
+    while True:
+        buf = list[int]()
 
-    return bytes(buf).decode("utf-8").rstrip("\r\n")
+        while not buf or buf[-1] != ord("\n"):
+            buf += await uart_sink.read(count=1)
+
+        line = bytes(buf).decode("utf-8").rstrip("\r\n")
+        if not line.startswith("@P "):
+            return line
+
+        cocotb.log.info(line)
 
 
 async def reset(dut: HierarchyObject):
@@ -2,6 +2,7 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import cocotb
+import re
 import struct
 
 from cocotb.triggers import Timer
@@ -20,6 +21,18 @@ async def test_axi_streaming_boot(dut: HierarchyObject):
 
     # AXI streaming boot is mostly driven by the firmware, so we don't have much to do here.
 
+    # The sender reports its throughput before activating the image.
+    line = await read_line(uart_sink)
+    match = re.fullmatch(r"Streamed (\d+) B in (\d+) cycles, (\d+) B/kcycle", line)
+    assert match, f"Unexpected line: {line!r}"
+    dut._log.info(f"Streamed {match[1]} B recovery image in {match[2]} cycles, {match[3]} B/kcycle")
+
+    # The receiver reports how long it took to drain the image before booting it.
+    line = await read_line(uart_sink)
+    match = re.fullmatch(r"Received (\d+) B in (\d+) cycles", line)
+    assert match, f"Unexpected line: {line!r}"
+    dut._log.info(f"Received {match[1]} B recovery image in {match[2]} cycles")
+
     # Wait for a message from the booted image.
     line = await read_line(uart_sink)
     assert line == "Hello from AXI streaming boot image."
@@ -14,6 +14,12 @@ _start:
         # Call main()
         call main
 
+        # Let the UART drain, output still in its FIFO is lost once the
+        # testbench terminates
+        mv  s0, a0
+        call uart_flush
+        mv  a0, s0
+
 .global _finish
 _finish:
         nop
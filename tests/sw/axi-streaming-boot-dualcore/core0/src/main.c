@@ -7,12 +7,14 @@
 #include "utils.h"
 #include "uart.h"
 #include "printf.h"
+#include "perf.h"
 
 int main(void)
 {
 	uart_init(UART_BAUD_RATE);
 	i3c_init();
-	
+	perf_init();
+
 	start_streaming_boot_reciver();
 
 	return 0;
@@ -1,7 +1,13 @@
 # SPDX-License-Identifier: Apache-2.0
 # Copyright (c) 2025-2026 Antmicro <www.antmicro.com>
 
+# The payload is built here, on the sending core, but runs on the core that
+# received it. MAILBOX, also used by the mailbox console backend, is the one of
+# core 0, which runs the streaming boot receiver, the exit code goes to the
+# mailbox of the core the payload actually runs on.
 .set MAILBOX, 0x80f80000
+.set MAILBOX1, 0x80f80008
+.global MAILBOX
 
 .section .text.init
 .global _start
@@ -16,6 +22,12 @@ _start:
         # Call main()
         call main
 
+        # Let the UART drain, output still in its FIFO is lost once the
+        # testbench terminates
+        mv  s0, a0
+        call uart_flush
+        mv  a0, s0
+
         # Map exit code: == 0 - success, != 0 - failure
         mv  a1, a0
         li  a0, 0xff # ok
@@ -25,6 +37,10 @@ _start:
 .global _finish
 _finish:
         li t0, MAILBOX
+        csrr t1, mhartid
+        beqz t1, 1f
+        li t0, MAILBOX1
+1:
         sb a0, 0(t0) # Signal testbench termination
         beq x0, x0, _finish
         .rept 10
@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include <stdint.h>
+#include "bench.h"
+#include "printf.h"
+
+int main(void)
+{
+	/* Results go to the mailbox console of this core (CONSOLE=mailbox in the
+	   Makefile), see tests/sw/libs/bench/bench.h for the format. */
+	printf("Benchmarks on core 0\r\n");
+	bench_suite();
+
+	return 0;
+}
@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include <stdint.h>
+#include "bench.h"
+#include "printf.h"
+
+int main(void)
+{
+	/* Results go to the mailbox console of this core (CONSOLE=mailbox in the
+	   Makefile), see tests/sw/libs/bench/bench.h for the format. Core 0 runs
+	   at the same time, so the peripheral kernels, which it runs, are left out
+	   to keep both cores off the shared peripherals and the I3C TX queue. */
+	printf("Benchmarks on core 1\r\n");
+	bench_suite_local();
+
+	return 0;
+}
@@ -1,7 +1,14 @@
 # SPDX-License-Identifier: Apache-2.0
 # Copyright (c) 2025-2026 Antmicro <www.antmicro.com>
 
+# Every profile other than the default one is built into its own directory, so
+# switching profiles never reuses objects or ELF files built for another one.
+PROFILE ?= default
+ifeq ($(PROFILE),default)
 BUILD_DIR ?= $(SCRIPT_DIR)/build
+else
+BUILD_DIR ?= $(SCRIPT_DIR)/build/$(PROFILE)
+endif
 LIB_BUILD_DIR := $(BUILD_DIR)/lib
 SW_DIR ?= $(SCRIPT_DIR)/../..
 
@@ -17,11 +24,37 @@ TEST_OBJS ?= $(addprefix $(BUILD_DIR)/,$(addsuffix .o,$(notdir $(basename $(TEST
 PICOLIBC_DIR ?= $(BUILD_DIR)/picolibc
 PICOLIBC_SPECS ?=  $(PICOLIBC_DIR)/install/picolibc.specs
 
+# PROFILE=perf links the tests that provide a <test>_perf.ld script for a core
+# built with the perf VeeR configuration (see the root Makefile). The code, data
+# and stack go to the ICCM and DCCM, which the testbench preloads from the ELF
+# file. For loaders using hex files, those sections are left out of the main hex
+# and written to the .iccm.hex and .dccm.hex files.
+PERF_LINK := $(wildcard $(SCRIPT_DIR)/src/$(TEST)_perf.ld)
+
+ifeq ($(PROFILE),perf)
+ifneq ($(PERF_LINK),)
+LINK ?= $(PERF_LINK)
+CCM_HEX_FILES := $(BUILD_DIR)/$(TEST).iccm.hex $(BUILD_DIR)/$(TEST).dccm.hex
+HEX_OBJCOPY_FLAGS := -R .iccm -R .dccm
+endif
+endif
+
+# Must match the iccm and dccm regions of the *_perf.ld scripts.
+ICCM_BASE ?= 0xee000000
+DCCM_BASE ?= 0xf0040000
+
 LINK ?= $(SCRIPT_DIR)/src/$(TEST).ld
 HEX_FILE ?= $(BUILD_DIR)/$(TEST).hex
 ELF_FILE ?= $(BUILD_DIR)/$(TEST).elf
 
-LIBS ?= uart i3c utils
+LIBS ?= uart i3c pic sched log utils perf
+
+# Backend of _putchar(), and so of printf(): uart, or mailbox to write the
+# characters straight to the testbench mailbox, which simulates much faster.
+CONSOLE ?= uart
+ifeq ($(CONSOLE),mailbox)
+LIBS += console_mailbox
+endif
 
 LIBS_DIR := $(SW_DIR)/libs
 LIB_INCLUDES := $(addprefix -I,$(addprefix $(LIBS_DIR)/,$(LIBS)))
@@ -38,11 +71,18 @@ $(ELF_FILE): $(PICOLIBC_SPECS) $(TEST_OBJS) $(BUILD_DIR) $(LIB_OBJS)
 	$(GCC_PREFIX)-objdump -S $@ > $(BUILD_DIR)/$(TEST).dis
 	$(GCC_PREFIX)-nm -B -n $@ > $(BUILD_DIR)/$(TEST).sym
 
-$(HEX_FILE): $(ELF_FILE)
-	$(GCC_PREFIX)-objcopy -O verilog --verilog-data-width=8 $^ $@
+$(HEX_FILE): $(ELF_FILE) $(CCM_HEX_FILES)
+	$(GCC_PREFIX)-objcopy -O verilog --verilog-data-width=8 $(HEX_OBJCOPY_FLAGS) $< $@
 	cp $@ $@.original
 	sed -i s/@../@00/g $@
 
+# 32-bit words, the width of the memory banks, addressed from the start of the memory.
+$(BUILD_DIR)/%.iccm.hex $(BUILD_DIR)/%.dccm.hex: $(ELF_FILE)
+	$(GCC_PREFIX)-objcopy -O verilog --verilog-data-width=4 -j .iccm \
+		--change-addresses -$(ICCM_BASE) $< $(BUILD_DIR)/$*.iccm.hex
+	$(GCC_PREFIX)-objcopy -O verilog --verilog-data-width=4 -j .dccm \
+		--change-addresses -$(DCCM_BASE) $< $(BUILD_DIR)/$*.dccm.hex
+
 $(PICOLIBC_SPECS): | $(BUILD_DIR)
 	mkdir -p $(PICOLIBC_DIR)
 	$(MAKE) -f ${RV_ROOT}/tools/picolibc.mk all BUILD_PATH=$(PICOLIBC_DIR)/build INSTALL_PATH=$(PICOLIBC_DIR)/install
@@ -2,11 +2,14 @@
 // Copyright (c) 2025-2026 Antmicro <www.antmicro.com>
 
 #include <stdint.h>
-#include <setjmp.h>
 #include "printf.h"
 #include "i3c.h"
 #include "utils.h"
 #include "uart.h"
+#include "pic.h"
+#include "sched.h"
+#include "crc32.h"
+#include "perf.h"
 
 /* ---------- Tests ---------- */
 
@@ -42,6 +45,156 @@ void test_i3c_read_write()
 	i3c_push_tx_desc(len);
 }
 
+#define ECHO_MSG_COUNT 16
+
+void test_i3c_echo_polled()
+{
+	uint8_t buf[I3C_MSG_MAX_LEN];
+
+	for (int n = 0; n < ECHO_MSG_COUNT; n++) {
+		while (!(read32(I3C_BASE + I3C_TTI_INTERRUPT_STATUS)
+			& I3C_TTI_INTERRUPT_RX_DESC_THLD_STAT))
+			;
+
+		size_t len = i3c_pop_rx_desc() & 0xFFFF;
+		i3c_read_rx_data(buf, len);
+
+		i3c_write_tx_data(buf, len);
+		i3c_push_tx_desc(len);
+	}
+
+	printf("done\r\n");
+}
+
+void test_i3c_echo_irq()
+{
+	uint8_t buf[I3C_MSG_MAX_LEN];
+
+	pic_init();
+	i3c_irq_init();
+	irq_enable();
+
+	for (int n = 0; n < ECHO_MSG_COUNT; n++) {
+		int len;
+
+		/* The core sleeps here until the ISR has queued a message. */
+		while ((len = i3c_recv(buf, sizeof(buf))) < 0)
+			i3c_wait_for_msg();
+
+		while (i3c_send(buf, len))
+			;
+	}
+
+	irq_disable();
+
+	printf("done\r\n");
+}
+
+#define STREAM_MSG_COUNT 16
+#define STREAM_MSG_LEN 8
+
+/* Queue more messages than both the TTI and the TX ring hold, so that the
+   ISR has to keep refilling the TTI as the controller reads them. */
+void test_i3c_stream_irq()
+{
+	uint8_t buf[STREAM_MSG_LEN];
+
+	pic_init();
+	i3c_irq_init();
+	irq_enable();
+
+	for (int n = 0; n < STREAM_MSG_COUNT; n++) {
+		for (int i = 0; i < STREAM_MSG_LEN; i++)
+			buf[i] = n * STREAM_MSG_LEN + i;
+
+		while (i3c_send(buf, sizeof(buf)))
+			;
+	}
+
+	while (i3c_tx_pending())
+		;
+
+	irq_disable();
+
+	printf("done\r\n");
+}
+
+#define UART_STRESS_BAUD	(921600)
+#define UART_STRESS_LEN		(512)
+#define UART_STRESS_LINE_MAX	(64)
+/* Long enough for several FIFOs' worth of characters to arrive, but short
+   enough for them to fit the RX ring. */
+#define UART_STRESS_BUSY_CYCLES	(50000)
+
+void test_uart_irq_stress()
+{
+	char line[UART_STRESS_LINE_MAX];
+	uint32_t crc = CRC32_INIT;
+	size_t received = 0, lines = 0;
+
+	printf("Switching to %u baud\r\n", UART_STRESS_BAUD);
+	uart_flush();
+	uart_init(UART_STRESS_BAUD);
+
+	pic_init();
+	/* Two characters of idle line complete a line without a newline. */
+	uart_irq_init(UART_RXILVL_16, UART_TXILVL_16, 20);
+	irq_enable();
+
+	printf("Ready\r\n");
+
+	while (received < UART_STRESS_LEN) {
+		/* Stay away from the UART meanwhile, everything that arrives has
+		   to be moved to the RX ring by the ISR. */
+		uint32_t start = csr_read(mcycle);
+		while (csr_read(mcycle) - start < UART_STRESS_BUSY_CYCLES)
+			;
+
+		int len;
+		while ((len = uart_getline(line, sizeof(line))) > 0) {
+			crc = crc32_update(crc, line, len);
+			received += len;
+			lines++;
+		}
+	}
+
+	irq_disable();
+
+	printf("Received %zu B in %zu lines, CRC %08x, %u overflows\r\n",
+	       received, lines, ~crc, uart_rx_overflows());
+}
+
+#define COPY_BENCH_LEN 64
+
+void test_i3c_copy_bench()
+{
+	/* One spare word so that the second buffer can be misaligned by a byte. */
+	static uint32_t bench_buf[2][COPY_BENCH_LEN / 4 + 1];
+	uint8_t *bufs[2] = { (uint8_t *)bench_buf[0], (uint8_t *)bench_buf[1] + 1 };
+	uint32_t rx_cycles[2], tx_cycles[2];
+
+	/* The first message takes the word-burst path, the second the byte path. */
+	for (int i = 0; i < 2; i++) {
+		i3c_wait_for_rx();
+
+		size_t len = i3c_pop_rx_desc() & 0xFFFF;
+		if (len > COPY_BENCH_LEN)
+			len = COPY_BENCH_LEN;
+
+		uint32_t start = csr_read(mcycle);
+		i3c_read_rx_data(bufs[i], len);
+		rx_cycles[i] = csr_read(mcycle) - start;
+
+		start = csr_read(mcycle);
+		i3c_write_tx_data(bufs[i], len);
+		tx_cycles[i] = csr_read(mcycle) - start;
+
+		i3c_push_tx_desc(len);
+	}
+
+	printf("%u %u %u %u\r\n", rx_cycles[0], rx_cycles[1], tx_cycles[0], tx_cycles[1]);
+}
+
 void test_i3c_getpid()
 {
 	(void)getchar();
@@ -85,39 +238,16 @@ void test_i3c_getdcr()
 #define MAX_STREAMING_BOOT_SIZE 0x1000
 extern uint8_t streaming_boot_buffer[MAX_STREAMING_BOOT_SIZE];
 
-int cur_task = -1;
-jmp_buf task_jmpbufs[2];
-
-void yield()
-{
-	if (cur_task == -1)
-		return;
-
-	if (setjmp(task_jmpbufs[cur_task]))
-		return;
-
-	cur_task = (cur_task + 1) % 2;
-	longjmp(task_jmpbufs[cur_task], 1);
-}
-
-
 void test_i3c_streaming_boot()
 {
 	/* Wait for RA to request management interface reset. */
-	while (1) {
-		uint32_t val = read32(I3C_BASE + I3C_SECFW_DEVICE_RESET);
-		uint32_t reset = val & I3C_SECFW_DEVICE_RESET_CTRL_MASK;
-
-		if (reset)
-			break;
-		yield();
-	}
+	sched_wait_reg_any(I3C_BASE + I3C_SECFW_DEVICE_RESET, I3C_SECFW_DEVICE_RESET_CTRL_MASK);
 
 	uint32_t val = read32(I3C_BASE + I3C_SECFW_DEVICE_RESET);
 	uint32_t reset = val & I3C_SECFW_DEVICE_RESET_CTRL_MASK;
 	uint32_t forced = (val >> I3C_SECFW_DEVICE_RESET_FORCED_SHIFT) & I3C_SECFW_DEVICE_RESET_FORCED_MASK;
 
-	yield();
+	sched_yield();
 
 	/* Enter streaming boot mode if requested. */
 	if (forced == I3C_SECFW_DEVICE_RESET_FORCED_STREAMING_BOOT) {
@@ -127,20 +257,19 @@ void test_i3c_streaming_boot()
 		write32(I3C_BASE + I3C_SECFW_RECOVERY_STATUS, I3C_SECFW_RECOVERY_STATUS_AWAITING);
 	}
 
-	yield();
+	sched_yield();
 
 	/* Clear reset. */
 	write32(I3C_BASE + I3C_SECFW_DEVICE_RESET, val);
 
-	yield();
+	sched_yield();
 
 	/* Wait for image size to be set. */
-	size_t image_size = 0;
-	while (!(image_size = read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_CTRL_1)))
-		yield();
+	sched_wait_reg_any(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_CTRL_1, 0xffffffff);
+	size_t image_size = read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_CTRL_1);
 	image_size *= 4;  /* INDIRECT_FIFO_CTRL_1 is in 4B word units. */
 
-	yield();
+	sched_yield();
 
 	/* Bail out if the image is too large. */
 	if (image_size > MAX_STREAMING_BOOT_SIZE) {
@@ -148,37 +277,28 @@ void test_i3c_streaming_boot()
 		return;
 	}
 
-	yield();
+	sched_yield();
 
 	/* Receive recovery image. */
+	size_t fifo_size = read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_3);
+	uint32_t *image = (uint32_t *)streaming_boot_buffer;
+	size_t image_words = image_size / 4;
 	size_t progress = 0;
-	while (progress < image_size) {
-		i3c_wait_for_payload_available();
-
-		while (!(read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_0)
-			& I3C_SECFW_INDIRECT_FIFO_EMPTY)) {
-			uint32_t data = read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_DATA);
 
-			for (size_t i = 0; i < 4; i++) {
-				streaming_boot_buffer[progress++] = data & 0xFF;
-				data >>= 8;
-			}
-			yield();
-		}
+	uint32_t start = csr_read(mcycle);
+	while (progress < image_words) {
+		/* Let the other tasks run until the sender has written more. */
+		sched_wait_reg(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_0, I3C_SECFW_INDIRECT_FIFO_EMPTY, 0);
 
-		yield();
+		progress += i3c_indirect_fifo_drain(image + progress, image_words - progress, fifo_size);
 	}
+	uint32_t rx_cycles = csr_read(mcycle) - start;
 
-	yield();
+	sched_yield();
 
 	/* Wait for boot request. */
-	while (1) {
-		uint32_t val = read32(I3C_BASE + I3C_SECFW_RECOVERY_CONTROL);
-		if (val & I3C_SECFW_RECOVERY_CONTROL_ACTIVATE)
-			break;
-
-		yield();
-	}
+	sched_wait_reg(I3C_BASE + I3C_SECFW_RECOVERY_CONTROL, I3C_SECFW_RECOVERY_CONTROL_ACTIVATE,
+		       I3C_SECFW_RECOVERY_CONTROL_ACTIVATE);
 
 	/* Clear image activation. */
 	write32(I3C_BASE + I3C_SECFW_RECOVERY_CONTROL, I3C_SECFW_RECOVERY_CONTROL_ACTIVATE);
@@ -186,7 +306,9 @@ void test_i3c_streaming_boot()
 	/* Notify sender of success. */
 	write32(I3C_BASE + I3C_SECFW_RECOVERY_STATUS, I3C_SECFW_RECOVERY_STATUS_SUCCESSFUL);
 
-	yield();
+	printf("Received %zu B in %u cycles\r\n", image_size, rx_cycles);
+
+	sched_yield();
 
 	((void(*)(void))streaming_boot_buffer)();
 }
@@ -234,52 +356,46 @@ const uint8_t axi_recovery_image[] = {
 };
 
 uint8_t axi_streaming_boot_writer_stack[0x1000] __attribute__((aligned(0x1000)));
-void axi_streaming_boot_writer()
+void axi_streaming_boot_writer(void *arg)
 {
 	const size_t len = sizeof(axi_recovery_image);
 
-	yield();
+	sched_yield();
 
 	/* Enable AXI bypass. */
 	uint32_t val = read32(I3C_BASE + I3C_SOCMGMT_REC_INTF_CFG);
 	val |= I3C_SOCMGMT_REC_INTF_CFG_BYPASS;
 	write32(I3C_BASE + I3C_SOCMGMT_REC_INTF_CFG, val);
 
-	yield();
+	sched_yield();
 
 	/* Enter streaming boot on next reset. */
 	write32(I3C_BASE + I3C_SECFW_DEVICE_RESET,
 		I3C_SECFW_DEVICE_RESET_FORCED_STREAMING_BOOT << I3C_SECFW_DEVICE_RESET_FORCED_SHIFT);
 
-	yield();
+	sched_yield();
 
 	/* Perform a management reset. */
 	write32(I3C_BASE + I3C_SOCMGMT_REC_INTF_REG_W1C_ACCESS,
 		I3C_SOCMGMT_REC_INTF_REG_DEVICE_MGMT_RESET);
 
-	yield();
+	sched_yield();
 
 	/* Wait for device to enter recovery mode. */
-	while (1) {
-		uint32_t val = read32(I3C_BASE + I3C_SECFW_DEVICE_STATUS_0);
+	sched_wait_reg(I3C_BASE + I3C_SECFW_DEVICE_STATUS_0, 0xffffffff,
+		       I3C_SECFW_DEV_STATUS_RECOVERY_READY | I3C_SECFW_REC_REASON_STREAMING_BOOT);
 
-		if (val == I3C_SECFW_DEV_STATUS_RECOVERY_READY | I3C_SECFW_REC_REASON_STREAMING_BOOT)
-			break;
-		yield();
-	}
-
-	yield();
+	sched_yield();
 
 	write32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_CTRL_1, (len + 3) / 4);
 
-	yield();
+	sched_yield();
 
 	/* Send the image. */
 	size_t progress = 0;
 	while (progress < len) {
-		while (!(read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_0)
-			& I3C_SECFW_INDIRECT_FIFO_EMPTY))
-			yield();
+		sched_wait_reg(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_0, I3C_SECFW_INDIRECT_FIFO_EMPTY,
+			       I3C_SECFW_INDIRECT_FIFO_EMPTY);
 
 		while (progress < len && !(read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_0)
 				& I3C_SECFW_INDIRECT_FIFO_FULL)) {
@@ -294,13 +410,13 @@ void axi_streaming_boot_writer()
 		}
 	}
 
-	yield();
+	sched_yield();
 
 	/* Boot the written image. */
 	write32(I3C_BASE + I3C_SOCMGMT_REC_INTF_REG_W1C_ACCESS,
 		I3C_SOCMGMT_REC_INTF_REG_ACTIVATE_IMAGE);
 
-	yield();
+	sched_yield();
 
 	/* Wait for the image to be booted. */
 	while (1) {
@@ -313,43 +429,25 @@ void axi_streaming_boot_writer()
 			break;
 		}
 
-		yield();
-	}
-
-	/* Hang forever, just in case the other side yields again. */
-	while (1) {
-		yield();
+		sched_yield();
 	}
 }
 
 void test_axi_streaming_boot()
 {
-	cur_task = 0;
-
-	/* Set up the AXI streaming boot writer. */
-	if(!setjmp(task_jmpbufs[cur_task])) {
-		cur_task = 1;
-		/* Run on separate stack. */
-		asm volatile (
-			     "mv sp, %0" "\n"
-			"\t" "jalr %1"   "\n"
-			"\t" "unimp"
-			     :
-			     : "r"(axi_streaming_boot_writer_stack),
-			       "r"(axi_streaming_boot_writer)
-			     : "memory");
-		__builtin_unreachable();
-	}
+	/* Run the AXI streaming boot writer as a separate task. */
+	sched_spawn(axi_streaming_boot_writer, NULL, axi_streaming_boot_writer_stack,
+		    sizeof(axi_streaming_boot_writer_stack));
 
 	/* Use the same receiver code as the I3C streaming boot test. */
 	test_i3c_streaming_boot();
 }
 
-
 int main(void)
 {
 	uart_init(UART_BAUD_RATE);
 	i3c_init();
+	perf_init();
 
 	printf("Hi Cocotb\r\n");
 
@@ -358,13 +456,22 @@ int main(void)
 	switch (test) {
 	case '1': test_i3c_setdasa(); break;
 	case '2': test_i3c_read_write(); break;
+	case '3': test_i3c_echo_polled(); break;
+	case '4': test_i3c_echo_irq(); break;
+	case '5': test_i3c_copy_bench(); break;
+	case '6': test_i3c_stream_irq(); break;
+	case 'U': test_uart_irq_stress(); break;
 	case 'p': test_i3c_getpid(); break;
 	case 'b': test_i3c_getbcr(); break;
 	case 'd': test_i3c_getdcr(); break;
 	case 'B': test_i3c_streaming_boot(); break;
 	case 'A': test_axi_streaming_boot(); break;
+	case 'C': start_streaming_boot_reciver(); break;
 	default: printf("?\r\n"); break;
 	}
 
+	/* Totals of the driver regions run by the test. */
+	perf_dump();
+
 	return 0;
 }
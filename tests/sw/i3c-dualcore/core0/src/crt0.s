@@ -1,7 +1,9 @@
 # SPDX-License-Identifier: Apache-2.0
 # Copyright (c) 2026 Antmicro <www.antmicro.com>
 
+# Mailbox of this core, also used by the mailbox console backend
 .set MAILBOX, 0x80f80000
+.global MAILBOX
 
 .section .text.init
 .global _start
@@ -16,6 +18,12 @@ _start:
         # Call main()
         call main
 
+        # Let the UART drain, output still in its FIFO is lost once the
+        # testbench terminates
+        mv  s0, a0
+        call uart_flush
+        mv  a0, s0
+
         # Map exit code: == 0 - success, != 0 - failure
         mv  a1, a0
         li  a0, 0xff # ok
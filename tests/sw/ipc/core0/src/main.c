@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include <stdint.h>
+#include "printf.h"
+#include "uart.h"
+#include "pic.h"
+#include "ipc.h"
+
+#define SHARED_COUNTER	((volatile uint32_t *)IPC_SHMEM_BASE)
+
+/* Doorbell bits and semaphore, must match core1/src/main.c. */
+#define BELL_READY	(1 << 0)
+#define BELL_PING	(1 << 1)
+#define BELL_PONG	(1 << 2)
+#define BELL_GO		(1 << 3)
+#define BELL_DONE	(1 << 4)
+#define SEM_COUNTER	(0)
+
+#define PING_ROUNDS	(16)
+#define COUNT_ROUNDS	(100)
+
+/* Both cores run this at the same time, the increments of one core would be
+   lost between the load and the store of the other without the semaphore. */
+static void count_up()
+{
+	for (int i = 0; i < COUNT_ROUNDS; i++) {
+		ipc_sem_lock(SEM_COUNTER);
+		*SHARED_COUNTER = *SHARED_COUNTER + 1;
+		ipc_sem_unlock(SEM_COUNTER);
+	}
+}
+
+static int test_sem_test_and_set()
+{
+	int first = ipc_sem_trylock(1);
+	int second = ipc_sem_trylock(1);
+
+	ipc_sem_unlock(1);
+
+	return first && !second;
+}
+
+int main(void)
+{
+	uint32_t start, cycles;
+
+	uart_init(UART_BAUD_RATE);
+	pic_init();
+	ipc_init(0);
+	irq_enable();
+
+	printf("Waiting for core 1\r\n");
+	ipc_wait(BELL_READY);
+
+	if (!test_sem_test_and_set()) {
+		printf("IPC: taking a taken semaphore succeeded\r\n");
+		return 1;
+	}
+
+	/* Every round wakes core 1 up from wfi and sleeps until it answers. */
+	start = csr_read(mcycle);
+	for (int i = 0; i < PING_ROUNDS; i++) {
+		ipc_ring(1, BELL_PING);
+		ipc_wait(BELL_PONG);
+	}
+	cycles = csr_read(mcycle) - start;
+	printf("IPC: doorbell round trip %u cycles\r\n", cycles / PING_ROUNDS);
+
+	*SHARED_COUNTER = 0;
+	ipc_ring(1, BELL_GO);
+	count_up();
+	ipc_wait(BELL_DONE);
+
+	printf("IPC: shared counter %u, expected %u\r\n", *SHARED_COUNTER, 2 * COUNT_ROUNDS);
+
+	return *SHARED_COUNTER != 2 * COUNT_ROUNDS;
+}
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include <stdint.h>
+#include "printf.h"
+#include "pic.h"
+#include "ipc.h"
+
+#define SHARED_COUNTER	((volatile uint32_t *)IPC_SHMEM_BASE)
+
+/* Doorbell bits and semaphore, must match core0/src/main.c. */
+#define BELL_READY	(1 << 0)
+#define BELL_PING	(1 << 1)
+#define BELL_PONG	(1 << 2)
+#define BELL_GO		(1 << 3)
+#define BELL_DONE	(1 << 4)
+#define SEM_COUNTER	(0)
+
+#define COUNT_ROUNDS	(100)
+
+static void count_up()
+{
+	for (int i = 0; i < COUNT_ROUNDS; i++) {
+		ipc_sem_lock(SEM_COUNTER);
+		*SHARED_COUNTER = *SHARED_COUNTER + 1;
+		ipc_sem_unlock(SEM_COUNTER);
+	}
+}
+
+int main(void)
+{
+	pic_init();
+	ipc_init(1);
+	irq_enable();
+
+	ipc_ring(0, BELL_READY);
+
+	/* Answer the pings of core 0 until it lets the counting start. */
+	while (1) {
+		uint32_t rung = ipc_wait(BELL_PING | BELL_GO);
+
+		if (rung & BELL_PING)
+			ipc_ring(0, BELL_PONG);
+		if (rung & BELL_GO)
+			break;
+	}
+
+	count_up();
+	ipc_ring(0, BELL_DONE);
+
+	/* Printed to the mailbox console of this core. */
+	printf("Core 1 done\r\n");
+
+	return 0;
+}
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include "bench.h"
+#include "printf.h"
+#include "utils.h"
+
+static uint32_t bench_overhead_cycles;
+static uint32_t bench_overhead_instret;
+static int bench_calibrated;
+
+/* Not inlined, so that it costs the same call as a real kernel. */
+static void __attribute__((noinline)) bench_empty()
+{
+	asm volatile ("");
+}
+
+static void bench_once(const struct bench *b, uint32_t *cycles, uint32_t *instret)
+{
+	if (b->setup)
+		b->setup();
+
+	uint32_t c0 = csr_read(mcycle);
+	uint32_t i0 = csr_read(minstret);
+	b->run();
+	uint32_t i1 = csr_read(minstret);
+	uint32_t c1 = csr_read(mcycle);
+
+	*cycles = c1 - c0;
+	*instret = i1 - i0;
+}
+
+static void bench_calibrate()
+{
+	const struct bench empty = { "empty", NULL, bench_empty };
+	uint32_t cycles, instret;
+
+	bench_overhead_cycles = UINT32_MAX;
+	for (int i = 0; i <= BENCH_RUNS; i++) {
+		bench_once(&empty, &cycles, &instret);
+		if (cycles < bench_overhead_cycles) {
+			bench_overhead_cycles = cycles;
+			bench_overhead_instret = instret;
+		}
+	}
+
+	bench_calibrated = 1;
+}
+
+void bench_measure(const struct bench *b, struct bench_result *result)
+{
+	uint32_t cycles, instret, total = 0;
+
+	if (!bench_calibrated)
+		bench_calibrate();
+
+	/* Warm-up run, not counted. */
+	bench_once(b, &cycles, &instret);
+
+	result->runs = BENCH_RUNS;
+	result->cycles_min = UINT32_MAX;
+	result->cycles_max = 0;
+
+	for (int i = 0; i < BENCH_RUNS; i++) {
+		bench_once(b, &cycles, &instret);
+		cycles = cycles > bench_overhead_cycles ? cycles - bench_overhead_cycles : 0;
+		instret = instret > bench_overhead_instret ? instret - bench_overhead_instret : 0;
+
+		total += cycles;
+		if (cycles < result->cycles_min) {
+			result->cycles_min = cycles;
+			result->instret = instret;
+		}
+		if (cycles > result->cycles_max)
+			result->cycles_max = cycles;
+	}
+
+	result->cycles_avg = total / BENCH_RUNS;
+}
+
+void bench_report(const char *name, const struct bench_result *result)
+{
+	printf("@B name=%s runs=%u cycles_min=%u cycles_avg=%u cycles_max=%u instret=%u\r\n",
+	       name, result->runs, result->cycles_min, result->cycles_avg, result->cycles_max,
+	       result->instret);
+}
+
+void bench_run(const struct bench *benches, size_t count)
+{
+	struct bench_result result;
+
+	for (size_t i = 0; i < count; i++) {
+		bench_measure(&benches[i], &result);
+		bench_report(benches[i].name, &result);
+	}
+}
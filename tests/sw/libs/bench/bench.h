@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Microbenchmark harness.
+
+   Every kernel is run once to warm up and then BENCH_RUNS times, with mcycle
+   and minstret read around each run. The cost of reading the counters and
+   calling an empty kernel is measured once and subtracted. The results are
+   printed through _putchar(), one line per kernel:
+
+       @B name=<name> runs=<n> cycles_min=<c> cycles_avg=<c> cycles_max=<c> instret=<i>
+
+   where instret is taken from the fastest run. tests/sw/tools/benchreport.py
+   collects these lines from console logs and compares them with a baseline. */
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS 8
+#endif
+
+struct bench {
+	const char *name;
+	/* Optional, called before every run outside of the measurement. */
+	void (*setup)(void);
+	void (*run)(void);
+};
+
+struct bench_result {
+	uint32_t runs;
+	uint32_t cycles_min;
+	uint32_t cycles_max;
+	uint32_t cycles_avg;
+	uint32_t instret;
+};
+
+void bench_measure(const struct bench*, struct bench_result*);
+
+void bench_report(const char*, const struct bench_result*);
+
+void bench_run(const struct bench*, size_t);
+
+/* The standard kernel set of tests/sw/bench. */
+void bench_suite();
+
+/* The part of it that doesn't touch the shared peripherals, for cores running
+   at the same time as one that runs bench_suite(). */
+void bench_suite_local();
+
+#endif
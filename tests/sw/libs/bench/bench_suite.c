@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include <string.h>
+#include "bench.h"
+#include "crc32.h"
+#include "i3c.h"
+#include "printf.h"
+#include "uart.h"
+
+#define BENCH_BUF_SIZE		(1024)
+#define BENCH_DIV_COUNT		(64)
+#define BENCH_MMIO_COUNT	(16)
+
+/* Aligned to their size, so that the same word of both is in the same bank of a
+   banked SRAM. */
+static uint32_t bench_src[BENCH_BUF_SIZE / 4] __attribute__((aligned(BENCH_BUF_SIZE)));
+static uint32_t bench_dst[BENCH_BUF_SIZE / 4] __attribute__((aligned(BENCH_BUF_SIZE)));
+static char bench_text[64];
+static volatile uint32_t bench_sink;
+
+static void bench_fill()
+{
+	for (size_t i = 0; i < BENCH_BUF_SIZE / 4; i++)
+		bench_src[i] = i * 0x9e3779b9;
+}
+
+static void bench_memcpy()
+{
+	memcpy(bench_dst, bench_src, BENCH_BUF_SIZE);
+}
+
+/* Back-to-back loads, which compete with the instruction fetches for the memory. */
+static void bench_load_sum()
+{
+	const volatile uint32_t *src = bench_src;
+	uint32_t acc = 0;
+
+	for (size_t i = 0; i < BENCH_BUF_SIZE / 4; i += 4)
+		acc += src[i] + src[i + 1] + src[i + 2] + src[i + 3];
+
+	bench_sink = acc;
+}
+
+/* Loads interleaved with stores. The stores go one 64-bit word ahead, so that
+   they hit a different bank than the loads next to them, which the banked SRAM
+   can then serve in the same cycle. */
+static void bench_load_store()
+{
+	const volatile uint32_t *src = bench_src;
+	volatile uint32_t *dst = bench_dst;
+	const size_t mask = BENCH_BUF_SIZE / 4 - 1;
+
+	for (size_t i = 0; i < BENCH_BUF_SIZE / 4; i += 2) {
+		dst[(i + 2) & mask] = src[i] + 1;
+		dst[(i + 3) & mask] = src[i + 1] + 1;
+	}
+}
+
+static void bench_memset()
+{
+	memset(bench_dst, 0x5a, BENCH_BUF_SIZE);
+}
+
+static void bench_crc32()
+{
+	bench_sink = crc32_update(CRC32_INIT, bench_src, BENCH_BUF_SIZE);
+}
+
+static void bench_div()
+{
+	uint32_t acc = 0;
+
+	/* The operands go through memory so that the divisions can't be folded. */
+	for (uint32_t i = 0; i < BENCH_DIV_COUNT; i++) {
+		bench_sink = bench_src[i] | 1;
+		acc += bench_src[i + 1] / bench_sink;
+	}
+
+	bench_sink = acc;
+}
+
+static void bench_printf()
+{
+	snprintf_(bench_text, sizeof(bench_text), "core %d: 0x%08x %u %s", 1, 0x1234abcd, 4096u,
+		  "done");
+}
+
+/* Reads of a status register without side effects, each one a full bus round trip. */
+static void bench_uart_mmio()
+{
+	for (int i = 0; i < BENCH_MMIO_COUNT; i++)
+		bench_sink = reg_read(UART_BASE + UART_STATUS_REG);
+}
+
+/* The I3C core runs in its own clock domain, behind the AXI CDC. */
+static void bench_i3c_mmio()
+{
+	for (int i = 0; i < BENCH_MMIO_COUNT; i++)
+		bench_sink = reg_read(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR);
+}
+
+/* Nothing reads the TX data queue here, so it is emptied before every run. */
+static void bench_i3c_tx_reset()
+{
+	reg_write(I3C_BASE + I3C_EC_OFFSET(TTI.RESET_CONTROL),
+		  REG_FIELD_MASK(I3C_TTI(RESET_CONTROL, TX_DATA_RST)));
+	reg_write(I3C_BASE + I3C_EC_OFFSET(TTI.RESET_CONTROL), 0);
+}
+
+static void bench_i3c_tx_copy()
+{
+	i3c_write_tx_data(bench_src, I3C_MSG_MAX_LEN);
+}
+
+static void bench_i3c_tx_copy_unaligned()
+{
+	i3c_write_tx_data((const char *)bench_src + 1, I3C_MSG_MAX_LEN - 1);
+}
+
+/* Kernels only using the core and its own memory. */
+static const struct bench bench_local_kernels[] = {
+	{ "memcpy_1k", NULL, bench_memcpy },
+	{ "load_sum_1k", NULL, bench_load_sum },
+	{ "load_store_1k", NULL, bench_load_store },
+	{ "memset_1k", NULL, bench_memset },
+	{ "crc32_1k", NULL, bench_crc32 },
+	{ "div_64", NULL, bench_div },
+	{ "snprintf", NULL, bench_printf },
+};
+
+/* Kernels using the peripherals, which are shared by all cores. */
+static const struct bench bench_periph_kernels[] = {
+	{ "uart_mmio_16", NULL, bench_uart_mmio },
+	{ "i3c_mmio_16", NULL, bench_i3c_mmio },
+	{ "i3c_tx_copy_64", bench_i3c_tx_reset, bench_i3c_tx_copy },
+	{ "i3c_tx_copy_63_unaligned", bench_i3c_tx_reset, bench_i3c_tx_copy_unaligned },
+};
+
+void bench_suite()
+{
+	bench_suite_local();
+	bench_run(bench_periph_kernels, sizeof(bench_periph_kernels) / sizeof(bench_periph_kernels[0]));
+}
+
+void bench_suite_local()
+{
+	bench_fill();
+	bench_run(bench_local_kernels, sizeof(bench_local_kernels) / sizeof(bench_local_kernels[0]));
+}
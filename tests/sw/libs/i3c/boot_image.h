@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef BOOT_IMAGE_H
+#define BOOT_IMAGE_H
+
+#include <stdint.h>
+
+/* Segmented streaming boot image, as produced by tests/sw/tools/mkbootimage.py.
+
+   The image is a stream of little-endian words: a header, a table of
+   num_segments segment descriptors and the contents of each segment in table
+   order, every segment padded to a whole word. With BOOT_IMAGE_FLAG_CRC32 set,
+   a trailer word holds the CRC-32 of everything before it. With
+   BOOT_IMAGE_FLAG_LZSS set, the contents of each segment are LZSS-compressed
+   (see lzss.h) and prefixed with a word giving their compressed size.
+
+   Images that don't start with BOOT_IMAGE_MAGIC are treated as raw code, loaded
+   at streaming_boot_buffer. */
+
+#define BOOT_IMAGE_MAGIC	(0x49425647)	/* "GVBI" */
+#define BOOT_IMAGE_MAX_SEGMENTS	(8)
+
+#define BOOT_IMAGE_FLAG_CRC32		(1 << 0)
+#define BOOT_IMAGE_FLAG_LZSS		(1 << 1)
+#define BOOT_IMAGE_FLAGS_SUPPORTED	(BOOT_IMAGE_FLAG_CRC32 | BOOT_IMAGE_FLAG_LZSS)
+
+struct boot_image_header {
+	uint32_t magic;
+	uint32_t entry;
+	uint32_t num_segments;
+	uint32_t flags;
+};
+
+struct boot_image_segment {
+	uint32_t addr;		/* Load address, word-aligned. */
+	uint32_t file_size;	/* Bytes of segment data in the stream. */
+	uint32_t mem_size;	/* Bytes in memory, the tail past file_size is zeroed. */
+};
+
+#define BOOT_IMAGE_HEADER_WORDS		(sizeof(struct boot_image_header) / 4)
+#define BOOT_IMAGE_SEGMENT_WORDS	(sizeof(struct boot_image_segment) / 4)
+
+#endif
@@ -1,95 +1,392 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (c) 2025-2026 Antmicro <www.antmicro.com>
 
+#include <string.h>
 #include "i3c.h"
+#include "printf.h"
+#include "crc32.h"
+#include "lzss.h"
+#include "perf.h"
 
-uint8_t streaming_boot_buffer[MAX_STREAMING_BOOT_SIZE] __attribute__((aligned(0x1000)));
+/* Raw images are executed from here, so the *_perf.ld scripts keep .bss.exec
+   in ram rather than in the DCCM, which code can't be fetched from. The other
+   linker scripts place it with the rest of .bss. */
+uint8_t streaming_boot_buffer[MAX_STREAMING_BOOT_SIZE]
+	__attribute__((aligned(0x1000), section(".bss.exec")));
 
 void i3c_wait_for_payload_available()
 {
 	/* We don't have access to the out-of-band recovery_payload_available_o signal, so
 	   synthesize it out of the events that cause it to be set. */
 	while (1) {
-		uint32_t val = read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_0);
+		uint32_t val = reg_read(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_0);
 		if (val & I3C_SECFW_INDIRECT_FIFO_FULL)
 			return;
 
-		val = read32(I3C_BASE + I3C_SECFW_RECOVERY_CONTROL);
+		val = reg_read(I3C_BASE + I3C_SECFW_RECOVERY_CONTROL);
 		if (val & I3C_SECFW_RECOVERY_CONTROL_ACTIVATE)
 			return;
 
 	}
 }
 
+size_t i3c_indirect_fifo_level(size_t fifo_size)
+{
+	uint32_t status = reg_read(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_0);
+
+	if (status & I3C_SECFW_INDIRECT_FIFO_EMPTY)
+		return 0;
+	if (status & I3C_SECFW_INDIRECT_FIFO_FULL)
+		return fifo_size;
+
+	/* Both indices wrap at the FIFO size. Only the writer can move between the
+	   reads above and below, so equal indices mean the FIFO has filled up. */
+	uint32_t wr = reg_read(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_1);
+	uint32_t rd = reg_read(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_2);
+	size_t level = wr >= rd ? wr - rd : fifo_size - rd + wr;
+
+	return (level && level < fifo_size) ? level : fifo_size;
+}
+
+size_t i3c_indirect_fifo_drain(uint32_t *buf, size_t max_words, size_t fifo_size)
+{
+	volatile uint32_t *port = (volatile uint32_t *)(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_DATA);
+	size_t words = i3c_indirect_fifo_level(fifo_size);
+
+	if (words > max_words)
+		words = max_words;
+
+	size_t left = words;
+	for (; left >= 4; left -= 4) {
+		buf[0] = *port;
+		buf[1] = *port;
+		buf[2] = *port;
+		buf[3] = *port;
+		buf += 4;
+	}
+	while (left--)
+		*buf++ = *port;
+
+	return words;
+}
+
+size_t i3c_indirect_fifo_drain_crc(uint32_t *buf, size_t max_words, size_t fifo_size,
+				   uint32_t *crc)
+{
+	volatile uint32_t *port = (volatile uint32_t *)(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_DATA);
+	size_t words = i3c_indirect_fifo_level(fifo_size);
+	uint32_t c = *crc;
+
+	if (words > max_words)
+		words = max_words;
+
+	/* Update the CRC while each word is still in a register, so that checking
+	   the image doesn't take another pass over memory. */
+	for (size_t i = 0; i < words; i++) {
+		uint32_t data = *port;
+
+		buf[i] = data;
+		c = crc32_word(c, data);
+	}
+
+	*crc = c;
+
+	return words;
+}
+
+void i3c_recv_image_words(uint32_t *buf, size_t words, size_t fifo_size, uint32_t *crc)
+{
+	PERF_REGION("i3c_fifo_recv");
+
+	while (words) {
+		size_t n = crc ? i3c_indirect_fifo_drain_crc(buf, words, fifo_size, crc)
+			       : i3c_indirect_fifo_drain(buf, words, fifo_size);
+
+		/* Only wait for the sender once the FIFO has run dry, it may be waiting
+		   for the FIFO to empty before it writes more. */
+		if (!n)
+			i3c_wait_for_payload_available();
+
+		buf += n;
+		words -= n;
+	}
+}
+
+static int i3c_segment_is_loadable(const struct boot_image_segment *seg)
+{
+	if (seg->addr & 3 || seg->file_size > seg->mem_size)
+		return 0;
+
+	return seg->addr >= STREAMING_BOOT_LOAD_BASE
+		&& seg->addr <= STREAMING_BOOT_LOAD_END
+		&& seg->mem_size <= STREAMING_BOOT_LOAD_END - seg->addr;
+}
+
+/* Decompresses a segment as its compressed stream arrives, staging at most one
+   chunk of it at a time. */
+static int i3c_recv_lzss_segment(const struct boot_image_segment *seg, size_t packed_size,
+				 size_t fifo_size, uint32_t *crc)
+{
+	PERF_REGION("boot_lzss");
+
+	uint32_t chunk[STREAMING_BOOT_CHUNK_WORDS];
+	struct lzss_state lz;
+	size_t words = (packed_size + 3) / 4;
+
+	lzss_init(&lz, (void *)seg->addr, seg->file_size);
+
+	while (words) {
+		size_t n = words > STREAMING_BOOT_CHUNK_WORDS ? STREAMING_BOOT_CHUNK_WORDS : words;
+		size_t bytes = n * 4 > packed_size ? packed_size : n * 4;
+
+		i3c_recv_image_words(chunk, n, fifo_size, crc);
+		if (lzss_feed(&lz, chunk, bytes))
+			return -1;
+
+		words -= n;
+		packed_size -= bytes;
+	}
+
+	return lzss_done(&lz) ? 0 : -1;
+}
+
+/* Receives the rest of a segmented image whose magic word has already been
+   consumed, writing each segment straight to its load address. Returns the
+   entry point, or 0 if the image is malformed or fails its integrity check. */
+static uint32_t i3c_recv_segmented_image(size_t image_words, size_t fifo_size)
+{
+	PERF_REGION("boot_segmented");
+
+	struct boot_image_header hdr;
+	struct boot_image_segment segs[BOOT_IMAGE_MAX_SEGMENTS];
+	uint32_t crc = CRC32_INIT;
+	uint32_t *crcp = NULL;
+
+	if (image_words < BOOT_IMAGE_HEADER_WORDS)
+		return 0;
+
+	hdr.magic = BOOT_IMAGE_MAGIC;
+	i3c_recv_image_words((uint32_t *)&hdr + 1, BOOT_IMAGE_HEADER_WORDS - 1, fifo_size, NULL);
+
+	if (hdr.num_segments > BOOT_IMAGE_MAX_SEGMENTS || hdr.flags & ~BOOT_IMAGE_FLAGS_SUPPORTED)
+		return 0;
+
+	if (hdr.flags & BOOT_IMAGE_FLAG_CRC32) {
+		crc = crc32_update(crc, &hdr, sizeof(hdr));
+		crcp = &crc;
+	}
+
+	/* Words left to receive, excluding the CRC trailer. */
+	size_t left = image_words - BOOT_IMAGE_HEADER_WORDS - (crcp ? 1 : 0);
+	size_t table_words = hdr.num_segments * BOOT_IMAGE_SEGMENT_WORDS;
+
+	if (table_words > left)
+		return 0;
+
+	i3c_recv_image_words((uint32_t *)segs, table_words, fifo_size, crcp);
+	left -= table_words;
+
+	/* Validate the whole table before touching memory. */
+	for (uint32_t i = 0; i < hdr.num_segments; i++) {
+		if (!i3c_segment_is_loadable(&segs[i]))
+			return 0;
+	}
+
+	for (uint32_t i = 0; i < hdr.num_segments; i++) {
+		uint32_t *dst = (uint32_t *)segs[i].addr;
+
+		if (hdr.flags & BOOT_IMAGE_FLAG_LZSS) {
+			uint32_t packed_size;
+
+			if (!left--)
+				return 0;
+			i3c_recv_image_words(&packed_size, 1, fifo_size, crcp);
+
+			size_t packed_words = (packed_size + 3) / 4;
+			if (packed_words > left)
+				return 0;
+
+			if (i3c_recv_lzss_segment(&segs[i], packed_size, fifo_size, crcp))
+				return 0;
+			left -= packed_words;
+		} else {
+			size_t file_words = (segs[i].file_size + 3) / 4;
+			if (file_words > left)
+				return 0;
+
+			i3c_recv_image_words(dst, file_words, fifo_size, crcp);
+			left -= file_words;
+		}
+
+		memset((uint8_t *)dst + segs[i].file_size, 0, segs[i].mem_size - segs[i].file_size);
+	}
+
+	if (left)
+		return 0;
+
+	if (crcp) {
+		uint32_t expected;
+
+		i3c_recv_image_words(&expected, 1, fifo_size, NULL);
+		if (~crc != expected)
+			return 0;
+	}
+
+	asm volatile ("fence.i");
+
+	return hdr.entry;
+}
+
 void start_streaming_boot_reciver()
 {
 	/* Wait for RA to request management interface reset. */
 	while (1) {
-		uint32_t val = read32(I3C_BASE + I3C_SECFW_DEVICE_RESET);
+		uint32_t val = reg_read(I3C_BASE + I3C_SECFW_DEVICE_RESET);
 		uint32_t reset = val & I3C_SECFW_DEVICE_RESET_CTRL_MASK;
 
 		if (reset)
 			break;
 	}
 
-	uint32_t val = read32(I3C_BASE + I3C_SECFW_DEVICE_RESET);
+	uint32_t val = reg_read(I3C_BASE + I3C_SECFW_DEVICE_RESET);
 	uint32_t reset = val & I3C_SECFW_DEVICE_RESET_CTRL_MASK;
-	uint32_t forced = (val >> I3C_SECFW_DEVICE_RESET_FORCED_SHIFT) & I3C_SECFW_DEVICE_RESET_FORCED_MASK;
+	uint32_t forced = REG_FIELD_GET(I3C_SECFW(DEVICE_RESET, FORCED_RECOVERY), val);
 
 	/* Enter streaming boot mode if requested. */
 	if (forced == I3C_SECFW_DEVICE_RESET_FORCED_STREAMING_BOOT) {
-		write32(I3C_BASE + I3C_SECFW_RECOVERY_STATUS, I3C_SECFW_RECOVERY_STATUS_AWAITING);
+		reg_write(I3C_BASE + I3C_SECFW_RECOVERY_STATUS, I3C_SECFW_RECOVERY_STATUS_AWAITING);
 
-		write32(I3C_BASE + I3C_SECFW_DEVICE_STATUS_0,
+		reg_write(I3C_BASE + I3C_SECFW_DEVICE_STATUS_0,
 			I3C_SECFW_DEV_STATUS_RECOVERY_READY | I3C_SECFW_REC_REASON_STREAMING_BOOT);
 	}
 
 	/* Clear reset. */
-	write32(I3C_BASE + I3C_SECFW_DEVICE_RESET, val);
+	reg_write(I3C_BASE + I3C_SECFW_DEVICE_RESET, val);
 
 	/* Wait for image size to be set. */
 	size_t image_size = 0;
-	while (!(image_size = read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_CTRL_1)))
+	while (!(image_size = reg_read(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_CTRL_1)))
 		;
 	image_size *= 4;  /* INDIRECT_FIFO_CTRL_1 is in 4B word units. */
 
-	/* Bail out if the image is too large. */
-	if (image_size > MAX_STREAMING_BOOT_SIZE) {
-		write32(I3C_BASE + I3C_SECFW_RECOVERY_STATUS, I3C_SECFW_RECOVERY_STATUS_FAILED);
+	/* Bail out if the image can't fit anywhere. */
+	if (image_size > MAX_STREAMING_BOOT_SIZE && image_size > STREAMING_BOOT_MAX_IMAGE_SIZE) {
+		reg_write(I3C_BASE + I3C_SECFW_RECOVERY_STATUS, I3C_SECFW_RECOVERY_STATUS_FAILED);
 		return;
 	}
 
 	/* Receive recovery image. */
-	size_t progress = 0;
-	while (progress < image_size) {
-		i3c_wait_for_payload_available();
-
-		while (!(read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_0)
-			& I3C_SECFW_INDIRECT_FIFO_EMPTY)) {
-			uint32_t data = read32(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_DATA);
-
-			for (size_t i = 0; i < 4; i++) {
-				streaming_boot_buffer[progress++] = data & 0xFF;
-				data >>= 8;
-			}
+	size_t fifo_size = reg_read(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_3);
+	size_t image_words = image_size / 4;
+	uint32_t magic, entry;
+
+	uint32_t start = csr_read(mcycle);
+	{
+		PERF_REGION("boot_recv");
+
+		i3c_recv_image_words(&magic, 1, fifo_size, NULL);
+
+		if (magic == BOOT_IMAGE_MAGIC) {
+			entry = i3c_recv_segmented_image(image_words, fifo_size);
+		} else if (image_size <= MAX_STREAMING_BOOT_SIZE) {
+			/* Raw image, executed in place from the staging buffer. */
+			uint32_t *image = (uint32_t *)streaming_boot_buffer;
+
+			image[0] = magic;
+			i3c_recv_image_words(image + 1, image_words - 1, fifo_size, NULL);
+			entry = (uint32_t)streaming_boot_buffer;
+		} else {
+			entry = 0;
 		}
+	}
+	uint32_t rx_cycles = csr_read(mcycle) - start;
 
+	if (!entry) {
+		reg_write(I3C_BASE + I3C_SECFW_RECOVERY_STATUS, I3C_SECFW_RECOVERY_STATUS_FAILED);
+		return;
 	}
 
 	/* Wait for boot request. */
 	while (1) {
-		uint32_t val = read32(I3C_BASE + I3C_SECFW_RECOVERY_CONTROL);
+		uint32_t val = reg_read(I3C_BASE + I3C_SECFW_RECOVERY_CONTROL);
 		if (val & I3C_SECFW_RECOVERY_CONTROL_ACTIVATE)
 			break;
 	}
 
 	/* Clear image activation. */
-	write32(I3C_BASE + I3C_SECFW_RECOVERY_CONTROL, I3C_SECFW_RECOVERY_CONTROL_ACTIVATE);
+	reg_write(I3C_BASE + I3C_SECFW_RECOVERY_CONTROL, I3C_SECFW_RECOVERY_CONTROL_ACTIVATE);
 
 	/* Notify sender of success. */
-	write32(I3C_BASE + I3C_SECFW_RECOVERY_STATUS, I3C_SECFW_RECOVERY_STATUS_SUCCESSFUL);
+	reg_write(I3C_BASE + I3C_SECFW_RECOVERY_STATUS, I3C_SECFW_RECOVERY_STATUS_SUCCESSFUL);
+
+	printf("Received %zu B in %u cycles\r\n", image_size, rx_cycles);
+	/* The image doesn't return, this is the last chance to report the regions. */
+	perf_dump();
+
+	((void(*)(void))entry)();
+}
+
+int i3c_axi_stream_image(const void *buf, size_t len)
+{
+	const uint8_t *rd = buf;
+
+	/* Enable AXI bypass. */
+	REG_UPDATE_FIELD(I3C_BASE + I3C_SOCMGMT_REC_INTF_CFG,
+			 I3C_SOCMGMT(REC_INTF_CFG, REC_INTF_BYPASS), 1);
+
+	/* Enter streaming boot on next reset. */
+	reg_write(I3C_BASE + I3C_SECFW_DEVICE_RESET,
+		I3C_SECFW_DEVICE_RESET_FORCED_STREAMING_BOOT << I3C_SECFW_DEVICE_RESET_FORCED_SHIFT);
+
+	/* Perform a management reset. */
+	reg_write(I3C_BASE + I3C_SOCMGMT_REC_INTF_REG_W1C_ACCESS,
+		I3C_SOCMGMT_REC_INTF_REG_DEVICE_MGMT_RESET);
+
+	/* Wait for device to enter recovery mode. */
+	while (reg_read(I3C_BASE + I3C_SECFW_DEVICE_STATUS_0)
+	       != (I3C_SECFW_DEV_STATUS_RECOVERY_READY | I3C_SECFW_REC_REASON_STREAMING_BOOT))
+		;
+
+	reg_write(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_CTRL_1, (len + 3) / 4);
+
+	/* Send the image, topping the FIFO up with as many words as it has room for
+	   so that the receiver always has something to drain. */
+	size_t fifo_size = reg_read(I3C_BASE + I3C_SECFW_INDIRECT_FIFO_STATUS_3);
+	size_t progress = 0;
+
+	uint32_t start = csr_read(mcycle);
+	{
+		PERF_REGION("i3c_axi_stream");
 
-	((void(*)(void))streaming_boot_buffer)();
+		while (progress < len) {
+			size_t room = 4 * (fifo_size - i3c_indirect_fifo_level(fifo_size));
+			size_t chunk = len - progress > room ? room : len - progress;
+
+			i3c_write_tx_data(rd + progress, chunk);
+			progress += chunk;
+		}
+	}
+	uint32_t cycles = csr_read(mcycle) - start;
+
+	/* Report before activating the image, the receiver may share the UART and
+	   only starts printing once it has been activated. */
+	printf("Streamed %zu B in %u cycles, %u B/kcycle\r\n",
+	       len, cycles, cycles ? (uint32_t)(len * 1000 / cycles) : 0);
+	perf_dump();
+
+	/* Boot the written image. */
+	reg_write(I3C_BASE + I3C_SOCMGMT_REC_INTF_REG_W1C_ACCESS,
+		I3C_SOCMGMT_REC_INTF_REG_ACTIVATE_IMAGE);
+
+	/* Wait for the image to be booted. */
+	while (1) {
+		uint32_t val = reg_read(I3C_BASE + I3C_SECFW_RECOVERY_STATUS);
+
+		if (val == I3C_SECFW_RECOVERY_STATUS_FAILED)
+			return -1;
+		if (val == I3C_SECFW_RECOVERY_STATUS_SUCCESSFUL)
+			return 0;
+	}
 }
 
 void i3c_init()
@@ -98,111 +395,122 @@ void i3c_init()
 	/* TODO: Leave at 0 for now, as in the i3c-core tests. */
 
 	/* Standby controller init. */
-	uint32_t val = read32(I3C_BASE + I3C_STBY_CR_CONTROL);
-	val &= ~I3C_STBY_CR_CONTROL_ENABLE_INIT_MASK;
-	val |= I3C_STBY_CR_CONTROL_ENABLE_INIT_RUN << I3C_STBY_CR_CONTROL_ENABLE_INIT_SHIFT;
-	write32(I3C_BASE + I3C_STBY_CR_CONTROL, val);
+	REG_UPDATE_FIELD(I3C_BASE + I3C_STBY_CR_CONTROL,
+			 I3C_STBY(STBY_CR_CONTROL, STBY_CR_ENABLE_INIT),
+			 I3C_STBY_CR_CONTROL_ENABLE_INIT_RUN);
 
 	/* Set static address. */
-	val = read32(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR);
-	val &= ~(I3C_STBY_CR_DEVICE_ADDR_ADDR_MASK << I3C_STBY_CR_DEVICE_ADDR_STATIC_SHIFT);
-	val |= STATIC_ADDR << I3C_STBY_CR_DEVICE_ADDR_STATIC_SHIFT;
-	val |= I3C_STBY_CR_DEVICE_ADDR_STATIC_VALID;
-	write32(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR, val);
+	reg_update(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR,
+		   REG_FIELD_MASK(I3C_STBY(STBY_CR_DEVICE_ADDR, STATIC_ADDR)) |
+		   REG_FIELD_MASK(I3C_STBY(STBY_CR_DEVICE_ADDR, STATIC_ADDR_VALID)),
+		   REG_FIELD_PREP(I3C_STBY(STBY_CR_DEVICE_ADDR, STATIC_ADDR), STATIC_ADDR) |
+		   REG_FIELD_PREP(I3C_STBY(STBY_CR_DEVICE_ADDR, STATIC_ADDR_VALID), 1));
 
 	/* Set virtual static address. */
-	val = read32(I3C_BASE + I3C_STBY_CR_VIRT_DEVICE_ADDR);
-	val &= ~(I3C_STBY_CR_DEVICE_ADDR_ADDR_MASK << I3C_STBY_CR_DEVICE_ADDR_STATIC_SHIFT);
-	val |= VIRT_STATIC_ADDR << I3C_STBY_CR_DEVICE_ADDR_STATIC_SHIFT;
-	val |= I3C_STBY_CR_DEVICE_ADDR_STATIC_VALID;
-	write32(I3C_BASE + I3C_STBY_CR_VIRT_DEVICE_ADDR, val);
+	reg_update(I3C_BASE + I3C_STBY_CR_VIRT_DEVICE_ADDR,
+		   REG_FIELD_MASK(I3C_STBY(STBY_CR_VIRT_DEVICE_ADDR, VIRT_STATIC_ADDR)) |
+		   REG_FIELD_MASK(I3C_STBY(STBY_CR_VIRT_DEVICE_ADDR, VIRT_STATIC_ADDR_VALID)),
+		   REG_FIELD_PREP(I3C_STBY(STBY_CR_VIRT_DEVICE_ADDR, VIRT_STATIC_ADDR), VIRT_STATIC_ADDR) |
+		   REG_FIELD_PREP(I3C_STBY(STBY_CR_VIRT_DEVICE_ADDR, VIRT_STATIC_ADDR_VALID), 1));
 
 	/* Enable target interface and SETDASA for address assignment. */
-	val = read32(I3C_BASE + I3C_STBY_CR_CONTROL);
-	val |= I3C_STBY_CR_CONTROL_TARGET_XACT_ENABLE;
-	val |= I3C_STBY_CR_CONTROL_DAA_SETDASA_ENABLE;
-	write32(I3C_BASE + I3C_STBY_CR_CONTROL, val);
+	reg_update(I3C_BASE + I3C_STBY_CR_CONTROL,
+		   I3C_STBY_CR_CONTROL_TARGET_XACT_ENABLE | I3C_STBY_CR_CONTROL_DAA_SETDASA_ENABLE,
+		   I3C_STBY_CR_CONTROL_TARGET_XACT_ENABLE | I3C_STBY_CR_CONTROL_DAA_SETDASA_ENABLE);
 
 	/* Configure TTI thresholds. */
-	val = read32(I3C_BASE + I3C_TTI_QUEUE_THLD_CTRL);
-	val &= ~I3C_TTI_QUEUE_THLD_CTRL_RX_DESC_MASK;
-	val |= I3C_TTI_QUEUE_THLD_CTRL_RX_DESC_INIT << I3C_TTI_QUEUE_THLD_CTRL_RX_DESC_SHIFT;
-	write32(I3C_BASE + I3C_TTI_QUEUE_THLD_CTRL, val);
-
-	val = read32(I3C_BASE + I3C_TTI_BUFFER_THLD_CTRL);
-	val &= ~I3C_TTI_BUFFER_THLD_CTRL_RX_DATA_MASK;
-	write32(I3C_BASE + I3C_TTI_BUFFER_THLD_CTRL, val);
+	REG_UPDATE_FIELD(I3C_BASE + I3C_TTI_QUEUE_THLD_CTRL,
+			 I3C_TTI(QUEUE_THLD_CTRL, RX_DESC_THLD),
+			 I3C_TTI_QUEUE_THLD_CTRL_RX_DESC_INIT);
+	REG_UPDATE_FIELD(I3C_BASE + I3C_TTI_BUFFER_THLD_CTRL,
+			 I3C_TTI(DATA_BUFFER_THLD_CTRL, RX_DATA_THLD), 0);
 
 	/* Enable RX and TX interrupts. */
-	val = read32(I3C_BASE + I3C_TTI_INTERRUPT_ENABLE);
-	val |= I3C_TTI_INTERRUPT_RX_DESC_STAT;
-	val |= I3C_TTI_INTERRUPT_TX_DESC_STAT;
-	write32(I3C_BASE + I3C_TTI_INTERRUPT_ENABLE, val);
+	reg_update(I3C_BASE + I3C_TTI_INTERRUPT_ENABLE,
+		   I3C_TTI_INTERRUPT_RX_DESC_STAT | I3C_TTI_INTERRUPT_TX_DESC_STAT,
+		   I3C_TTI_INTERRUPT_RX_DESC_STAT | I3C_TTI_INTERRUPT_TX_DESC_STAT);
 
 	/* Program recovery interface capabilities. */
-	val = 0;
-	val |= I3C_SECFW_PROT_CAP_VERSION_1p1;
-	val |= I3C_SECFW_PROT_CAP_DEVICE_ID;
-	val |= I3C_SECFW_PROT_CAP_FORCED_RECOVERY;
-	val |= I3C_SECFW_PROT_CAP_MGMT_RESET;
-	val |= I3C_SECFW_PROT_CAP_DEVICE_STATUS;
-	val |= I3C_SECFW_PROT_CAP_INDIRECT_CTRL;
-	val |= I3C_SECFW_PROT_CAP_PUSH_CIMAGE_SUPPORT;
-	val |= I3C_SECFW_PROT_CAP_FLASHLESS_BOOT;
-	write32(I3C_BASE + I3C_SECFW_PROT_CAP_2, val);
+	reg_write(I3C_BASE + I3C_SECFW_PROT_CAP_2,
+		  REG_FIELD_PREP(I3C_SECFW(PROT_CAP_2, REC_PROT_VERSION), I3C_SECFW_PROT_CAP_VERSION_1p1) |
+		  I3C_SECFW_PROT_CAP_DEVICE_ID |
+		  I3C_SECFW_PROT_CAP_FORCED_RECOVERY |
+		  I3C_SECFW_PROT_CAP_MGMT_RESET |
+		  I3C_SECFW_PROT_CAP_DEVICE_STATUS |
+		  I3C_SECFW_PROT_CAP_INDIRECT_CTRL |
+		  I3C_SECFW_PROT_CAP_PUSH_CIMAGE_SUPPORT |
+		  I3C_SECFW_PROT_CAP_FLASHLESS_BOOT);
 }
 
 void i3c_clear_dynamic_addr()
 {
-	uint32_t val = read32(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR);
-	val &= ~I3C_STBY_CR_DEVICE_ADDR_DYNAMIC_VALID;
-	val &= ~(I3C_STBY_CR_DEVICE_ADDR_ADDR_MASK << I3C_STBY_CR_DEVICE_ADDR_DYNAMIC_SHIFT);
-	write32(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR, val);
+	reg_update(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR,
+		   REG_FIELD_MASK(I3C_STBY(STBY_CR_DEVICE_ADDR, DYNAMIC_ADDR)) |
+		   REG_FIELD_MASK(I3C_STBY(STBY_CR_DEVICE_ADDR, DYNAMIC_ADDR_VALID)), 0);
 }
 
 int i3c_has_dynamic_addr()
 {
-	return (read32(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR) & I3C_STBY_CR_DEVICE_ADDR_DYNAMIC_VALID) > 0;
+	return REG_READ_FIELD(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR,
+			      I3C_STBY(STBY_CR_DEVICE_ADDR, DYNAMIC_ADDR_VALID));
 }
 
 uint8_t i3c_dynamic_addr()
 {
-	uint32_t val = read32(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR);
-	val >>= I3C_STBY_CR_DEVICE_ADDR_DYNAMIC_SHIFT;
-	val &= I3C_STBY_CR_DEVICE_ADDR_ADDR_MASK;
-	return val;
+	return REG_READ_FIELD(I3C_BASE + I3C_STBY_CR_DEVICE_ADDR,
+			      I3C_STBY(STBY_CR_DEVICE_ADDR, DYNAMIC_ADDR));
 }
 
 void i3c_wait_for_rx()
 {
-	while (!(read32(I3C_BASE + I3C_TTI_INTERRUPT_STATUS) & I3C_TTI_INTERRUPT_RX_DESC_STAT))
+	while (!(reg_read(I3C_BASE + I3C_TTI_INTERRUPT_STATUS) & I3C_TTI_INTERRUPT_RX_DESC_STAT))
 		;
 }
 
 void i3c_wait_for_tx()
 {
-	while (!(read32(I3C_BASE + I3C_TTI_INTERRUPT_STATUS) & I3C_TTI_INTERRUPT_TX_DESC_STAT))
+	while (!(reg_read(I3C_BASE + I3C_TTI_INTERRUPT_STATUS) & I3C_TTI_INTERRUPT_TX_DESC_STAT))
 		;
 }
 
 uint32_t i3c_pop_rx_desc()
 {
-	return read32(I3C_BASE + I3C_TTI_RX_DESC_QUEUE_PORT);
+	return reg_read(I3C_BASE + I3C_TTI_RX_DESC_QUEUE_PORT);
 }
 
 void i3c_push_tx_desc(uint32_t desc)
 {
-	return write32(I3C_BASE + I3C_TTI_TX_DESC_QUEUE_PORT, desc);
+	return reg_write(I3C_BASE + I3C_TTI_TX_DESC_QUEUE_PORT, desc);
 }
 
 void i3c_read_rx_data(void *buf, size_t len)
 {
+	volatile uint32_t *port = (volatile uint32_t *)(I3C_BASE + I3C_TTI_RX_DATA_PORT);
 	char *wr = buf;
 
+	/* Fast path: copy whole words straight into word-aligned buffers. */
+	if (!((uintptr_t)wr & 3)) {
+		uint32_t *wr32 = (uint32_t *)wr;
+		size_t words = len / 4;
+
+		for (; words >= 4; words -= 4) {
+			wr32[0] = *port;
+			wr32[1] = *port;
+			wr32[2] = *port;
+			wr32[3] = *port;
+			wr32 += 4;
+		}
+		while (words--)
+			*wr32++ = *port;
+
+		wr = (char *)wr32;
+		len &= 3;
+	}
+
 	size_t progress = 0;
 	while (progress < len) {
 		size_t chunk = len - progress > 4 ? 4 : len - progress;
-		uint32_t data = read32(I3C_BASE + I3C_TTI_RX_DATA_PORT);
+		uint32_t data = *port;
 
 		for (size_t i = 0; i < chunk; i++) {
 			*wr++ = data & 0xFF;
@@ -215,8 +523,28 @@ void i3c_read_rx_data(void *buf, size_t len)
 
 void i3c_write_tx_data(const void *buf, size_t len)
 {
+	volatile uint32_t *port = (volatile uint32_t *)(I3C_BASE + I3C_TTI_TX_DATA_PORT);
 	const char *rd = buf;
 
+	/* Fast path: copy whole words straight from word-aligned buffers. */
+	if (!((uintptr_t)rd & 3)) {
+		const uint32_t *rd32 = (const uint32_t *)rd;
+		size_t words = len / 4;
+
+		for (; words >= 4; words -= 4) {
+			*port = rd32[0];
+			*port = rd32[1];
+			*port = rd32[2];
+			*port = rd32[3];
+			rd32 += 4;
+		}
+		while (words--)
+			*port = *rd32++;
+
+		rd = (const char *)rd32;
+		len &= 3;
+	}
+
 	size_t progress = 0;
 	while (progress < len) {
 		size_t chunk = len - progress > 4 ? 4 : len - progress;
@@ -226,8 +554,200 @@ void i3c_write_tx_data(const void *buf, size_t len)
 			data |= (uint32_t)(*rd++) << (i * 8);
 		}
 
-		write32(I3C_BASE + I3C_TTI_TX_DATA_PORT, data);
+		*port = data;
 
 		progress += chunk;
 	}
 }
+
+/* ---------- Interrupt-driven TTI driver ---------- */
+
+#define I3C_RING_MASK	(I3C_RING_SIZE - 1)
+
+struct i3c_msg {
+	uint32_t len;
+	uint32_t data[(I3C_MSG_MAX_LEN + 3) / 4];
+};
+
+/* Both rings use free-running indices: the producer only advances head and
+   the consumer only advances tail, so no locking is needed between the ISR
+   and the application for RX. */
+struct i3c_ring {
+	volatile uint32_t head;
+	volatile uint32_t tail;
+	struct i3c_msg msgs[I3C_RING_SIZE];
+};
+
+static struct i3c_ring i3c_rx_ring;
+static struct i3c_ring i3c_tx_ring;
+
+static volatile uint32_t i3c_rx_dropped_count;
+
+static int i3c_ring_empty(struct i3c_ring *ring)
+{
+	return ring->head == ring->tail;
+}
+
+static int i3c_ring_full(struct i3c_ring *ring)
+{
+	return ring->head - ring->tail == I3C_RING_SIZE;
+}
+
+static void i3c_drain_rx()
+{
+	PERF_REGION("i3c_rx");
+
+	while (reg_read(I3C_BASE + I3C_TTI_INTERRUPT_STATUS) & I3C_TTI_INTERRUPT_RX_DESC_THLD_STAT) {
+		uint32_t len = i3c_pop_rx_desc() & 0xFFFF;
+		uint32_t words = (len + 3) / 4;
+
+		if (len > I3C_MSG_MAX_LEN || i3c_ring_full(&i3c_rx_ring)) {
+			/* Discard the payload to keep the RX data queue in sync. */
+			for (uint32_t i = 0; i < words; i++)
+				(void)reg_read(I3C_BASE + I3C_TTI_RX_DATA_PORT);
+
+			i3c_rx_dropped_count++;
+			continue;
+		}
+
+		struct i3c_msg *msg = &i3c_rx_ring.msgs[i3c_rx_ring.head & I3C_RING_MASK];
+		for (uint32_t i = 0; i < words; i++)
+			msg->data[i] = reg_read(I3C_BASE + I3C_TTI_RX_DATA_PORT);
+		msg->len = len;
+
+		asm volatile ("" ::: "memory");
+		i3c_rx_ring.head++;
+	}
+}
+
+/* The TX descriptor threshold is set up in i3c_irq_init() so that this status
+   is set while fewer than I3C_TX_HW_SLOTS messages are queued in the TTI. */
+static int i3c_tx_hw_has_room()
+{
+	return reg_read(I3C_BASE + I3C_TTI_INTERRUPT_STATUS) & I3C_TTI_INTERRUPT_TX_DESC_THLD_STAT;
+}
+
+static void i3c_refill_tx()
+{
+	PERF_REGION("i3c_tx");
+
+	while (!i3c_ring_empty(&i3c_tx_ring) && i3c_tx_hw_has_room()) {
+		struct i3c_msg *msg = &i3c_tx_ring.msgs[i3c_tx_ring.tail & I3C_RING_MASK];
+		uint32_t words = (msg->len + 3) / 4;
+
+		for (uint32_t i = 0; i < words; i++)
+			reg_write(I3C_BASE + I3C_TTI_TX_DATA_PORT, msg->data[i]);
+		i3c_push_tx_desc(msg->len);
+
+		i3c_tx_ring.tail++;
+	}
+
+	/* The threshold status stays set for as long as the queues have room, so
+	   only wait for it while there is something left to stage. */
+	reg_update(I3C_BASE + I3C_TTI_INTERRUPT_ENABLE, I3C_TTI_INTERRUPT_TX_DESC_THLD_STAT,
+		   i3c_ring_empty(&i3c_tx_ring) ? 0 : I3C_TTI_INTERRUPT_TX_DESC_THLD_STAT);
+}
+
+static void i3c_irq_handler()
+{
+	uint32_t status = reg_read(I3C_BASE + I3C_TTI_INTERRUPT_STATUS);
+
+	/* Acknowledge the events before handling them, so that new ones raised
+	   while draining are not lost. */
+	reg_write(I3C_BASE + I3C_TTI_INTERRUPT_STATUS,
+		status & (I3C_TTI_INTERRUPT_RX_DESC_STAT | I3C_TTI_INTERRUPT_TX_DESC_STAT));
+
+	i3c_drain_rx();
+	i3c_refill_tx();
+}
+
+void i3c_irq_init()
+{
+	i3c_rx_ring.head = i3c_rx_ring.tail = 0;
+	i3c_tx_ring.head = i3c_tx_ring.tail = 0;
+	i3c_rx_dropped_count = 0;
+
+	/* The TX descriptor threshold counts free entries, the queue size is
+	   encoded as 2^(N+1) entries. */
+	uint32_t tx_desc_entries = 2 << REG_READ_FIELD(I3C_BASE + I3C_TTI_QUEUE_SIZE,
+						       I3C_TTI(QUEUE_SIZE, TX_DESC_BUFFER_SIZE));
+	REG_UPDATE_FIELD(I3C_BASE + I3C_TTI_QUEUE_THLD_CTRL, I3C_TTI(QUEUE_THLD_CTRL, TX_DESC_THLD),
+			 tx_desc_entries - I3C_TX_HW_SLOTS + 1);
+
+	/* RX descriptor threshold is 1 (see i3c_init()), so this status stays set
+	   for as long as there are descriptors to drain. */
+	uint32_t irqs = I3C_TTI_INTERRUPT_RX_DESC_STAT | I3C_TTI_INTERRUPT_TX_DESC_STAT |
+			I3C_TTI_INTERRUPT_RX_DESC_THLD_STAT;
+	reg_update(I3C_BASE + I3C_TTI_INTERRUPT_ENABLE, irqs, irqs);
+
+	pic_register_irq(PIC_IRQ_I3C, i3c_irq_handler, 1);
+}
+
+int i3c_recv(void *buf, size_t len)
+{
+	if (i3c_ring_empty(&i3c_rx_ring))
+		return -1;
+
+	struct i3c_msg *msg = &i3c_rx_ring.msgs[i3c_rx_ring.tail & I3C_RING_MASK];
+	size_t count = msg->len < len ? msg->len : len;
+	memcpy(buf, msg->data, count);
+
+	asm volatile ("" ::: "memory");
+	i3c_rx_ring.tail++;
+
+	return count;
+}
+
+int i3c_send(const void *buf, size_t len)
+{
+	if (len > I3C_MSG_MAX_LEN)
+		return -1;
+
+	uint32_t mstatus = csr_read(mstatus);
+	irq_disable();
+
+	if (i3c_ring_full(&i3c_tx_ring)) {
+		if (mstatus & MSTATUS_MIE)
+			irq_enable();
+		return -1;
+	}
+
+	struct i3c_msg *msg = &i3c_tx_ring.msgs[i3c_tx_ring.head & I3C_RING_MASK];
+	memcpy(msg->data, buf, len);
+	msg->len = len;
+	i3c_tx_ring.head++;
+
+	/* Stage it right away if the TX queues have room, so that a read which
+	   arrives before the next interrupt is not NACKed. */
+	i3c_refill_tx();
+
+	if (mstatus & MSTATUS_MIE)
+		irq_enable();
+
+	return 0;
+}
+
+void i3c_wait_for_msg()
+{
+	while (1) {
+		irq_disable();
+		if (!i3c_ring_empty(&i3c_rx_ring)) {
+			irq_enable();
+			return;
+		}
+
+		wait_for_interrupt();
+		irq_enable();
+	}
+}
+
+/* Messages passed to i3c_send() which are not staged in the TTI yet. */
+size_t i3c_tx_pending()
+{
+	return i3c_tx_ring.head - i3c_tx_ring.tail;
+}
+
+uint32_t i3c_rx_dropped()
+{
+	return i3c_rx_dropped_count;
+}
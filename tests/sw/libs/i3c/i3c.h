@@ -9,11 +9,55 @@
 #include <stdarg.h>
 #include <stddef.h>
 #include "utils.h"
+#include "i3c_registers.h"
+#include "pic.h"
+#include "boot_image.h"
 
 #ifndef MAX_STREAMING_BOOT_SIZE
 #define MAX_STREAMING_BOOT_SIZE 0x1000
 #endif
 
+/* Memory segmented streaming boot images may be loaded to. Defaults to the
+   upper part of lmem0, above the firmware of core 0, which the linker scripts
+   of the receivers check. */
+#ifndef STREAMING_BOOT_LOAD_BASE
+#define STREAMING_BOOT_LOAD_BASE 0x80010000
+#endif
+
+#ifndef STREAMING_BOOT_LOAD_END
+#define STREAMING_BOOT_LOAD_END 0x8001f400
+#endif
+
+/* Compressed segments are staged in chunks of this many words while they are
+   decompressed to their load address. */
+#ifndef STREAMING_BOOT_CHUNK_WORDS
+#define STREAMING_BOOT_CHUNK_WORDS 64
+#endif
+
+/* Largest segmented image: the load window plus the header, the segment table,
+   the packed size word of every LZSS segment and the CRC trailer. */
+#define STREAMING_BOOT_MAX_IMAGE_SIZE \
+	(STREAMING_BOOT_LOAD_END - STREAMING_BOOT_LOAD_BASE \
+	 + 4 * (BOOT_IMAGE_HEADER_WORDS + BOOT_IMAGE_MAX_SEGMENTS * BOOT_IMAGE_SEGMENT_WORDS) \
+	 + BOOT_IMAGE_MAX_SEGMENTS * sizeof(uint32_t) + sizeof(uint32_t))
+
+/* Largest private transfer handled by the interrupt-driven TTI driver. */
+#ifndef I3C_MSG_MAX_LEN
+#define I3C_MSG_MAX_LEN 64
+#endif
+
+/* Number of messages buffered in each direction, must be a power of two. */
+#ifndef I3C_RING_SIZE
+#define I3C_RING_SIZE 8
+#endif
+
+/* Number of messages staged in the TTI TX queues before deferring to the ring.
+   I3C_TX_HW_SLOTS * I3C_MSG_MAX_LEN must fit in the TX data queue, and
+   I3C_TX_HW_SLOTS can't exceed the TX descriptor queue. */
+#ifndef I3C_TX_HW_SLOTS
+#define I3C_TX_HW_SLOTS 4
+#endif
+
 /* ---------- I3C ---------- */
 
 #define I3C_BASE	(0x30001000)
@@ -43,10 +87,13 @@
 #define I3C_TTI_INTERRUPT_ENABLE		(0x1d4)
 #define  I3C_TTI_INTERRUPT_RX_DESC_STAT		(1 << 0)
 #define  I3C_TTI_INTERRUPT_TX_DESC_STAT		(1 << 1)
+#define  I3C_TTI_INTERRUPT_TX_DESC_THLD_STAT	(1 << 10)
+#define  I3C_TTI_INTERRUPT_RX_DESC_THLD_STAT	(1 << 11)
 #define I3C_TTI_RX_DESC_QUEUE_PORT		(0x1dc)
 #define I3C_TTI_RX_DATA_PORT			(0x1e0)
 #define I3C_TTI_TX_DESC_QUEUE_PORT		(0x1e4)
 #define I3C_TTI_TX_DATA_PORT			(0x1e8)
+#define I3C_TTI_QUEUE_SIZE			(0x1f0)
 #define I3C_TTI_QUEUE_THLD_CTRL			(0x1f8)
 #define  I3C_TTI_QUEUE_THLD_CTRL_RX_DESC_SHIFT	(8)
 #define  I3C_TTI_QUEUE_THLD_CTRL_RX_DESC_MASK	(0xff00)
@@ -83,6 +130,9 @@
 #define I3C_SECFW_INDIRECT_FIFO_STATUS_0	(0x150)
 #define  I3C_SECFW_INDIRECT_FIFO_EMPTY		(1 << 0)
 #define  I3C_SECFW_INDIRECT_FIFO_FULL		(1 << 1)
+#define I3C_SECFW_INDIRECT_FIFO_STATUS_1	(0x154)	/* Write index, in 4B words. */
+#define I3C_SECFW_INDIRECT_FIFO_STATUS_2	(0x158)	/* Read index, in 4B words. */
+#define I3C_SECFW_INDIRECT_FIFO_STATUS_3	(0x15c)	/* FIFO size, in 4B words. */
 #define I3C_SECFW_INDIRECT_FIFO_DATA		(0x168)
 
 #define I3C_SOCMGMT_REC_INTF_CFG		(0x20c)
@@ -92,14 +142,46 @@
 #define  I3C_SOCMGMT_REC_INTF_REG_DEVICE_MGMT_RESET	(0x02 << 0)
 #define  I3C_SOCMGMT_REC_INTF_REG_ACTIVATE_IMAGE	(0x0f << 8)
 
+/* Shorthands for the PeakRDL field names in i3c_registers.h, for use with the
+   REG_FIELD_* helpers, e.g. REG_FIELD_PREP(I3C_STBY(STBY_CR_CONTROL, STBY_CR_ENABLE_INIT), 2). */
+#define I3C_SECFW(reg, field) \
+	SECUREFIRMWARERECOVERYINTERFACEREGISTERS__##reg##__##field
+#define I3C_STBY(reg, field) \
+	STANDBYCONTROLLERMODEREGISTERS_PID_HI_7FFF_PID_LO_5A00A5_VIRTUAL_PID_HI_7FFF_VIRTUAL_PID_LO_5A10A5__##reg##__##field
+#define I3C_TTI(reg, field) \
+	TARGETTRANSACTIONINTERFACEREGISTERS_RX_DESC_FIFO_SIZE_5_TX_DESC_FIFO_SIZE_5_RX_FIFO_SIZE_5_TX_FIFO_SIZE_5_IBI_FIFO_SIZE_5__##reg##__##field
+#define I3C_SOCMGMT(reg, field) \
+	SOCMANAGEMENTINTERFACEREGISTERS__##reg##__##field
+
+/* Offset of a register within I3C_EC, e.g. I3C_EC_OFFSET(TTI.INTERRUPT_STATUS). */
+#define I3C_EC_OFFSET(reg)	offsetof(I3CCSR_t, I3C_EC.reg)
+
+static_assert(I3C_EC_OFFSET(SecFwRecoveryIf.PROT_CAP_2) == I3C_SECFW_PROT_CAP_2, "I3C register map mismatch");
+static_assert(I3C_EC_OFFSET(SecFwRecoveryIf.INDIRECT_FIFO_DATA) == I3C_SECFW_INDIRECT_FIFO_DATA, "I3C register map mismatch");
+static_assert(I3C_EC_OFFSET(StdbyCtrlMode.STBY_CR_CONTROL) == I3C_STBY_CR_CONTROL, "I3C register map mismatch");
+static_assert(I3C_EC_OFFSET(StdbyCtrlMode.STBY_CR_VIRT_DEVICE_ADDR) == I3C_STBY_CR_VIRT_DEVICE_ADDR, "I3C register map mismatch");
+static_assert(I3C_EC_OFFSET(TTI.INTERRUPT_STATUS) == I3C_TTI_INTERRUPT_STATUS, "I3C register map mismatch");
+static_assert(I3C_EC_OFFSET(TTI.QUEUE_SIZE) == I3C_TTI_QUEUE_SIZE, "I3C register map mismatch");
+static_assert(I3C_EC_OFFSET(TTI.DATA_BUFFER_THLD_CTRL) == I3C_TTI_BUFFER_THLD_CTRL, "I3C register map mismatch");
+static_assert(I3C_EC_OFFSET(SoCMgmtIf.REC_INTF_REG_W1C_ACCESS) == I3C_SOCMGMT_REC_INTF_REG_W1C_ACCESS, "I3C register map mismatch");
 
 #define STATIC_ADDR (0x5A)
 #define VIRT_STATIC_ADDR (0x6A)
 
 void i3c_wait_for_payload_available();
 
+size_t i3c_indirect_fifo_level(size_t);
+
+size_t i3c_indirect_fifo_drain(uint32_t*, size_t, size_t);
+
+size_t i3c_indirect_fifo_drain_crc(uint32_t*, size_t, size_t, uint32_t*);
+
+void i3c_recv_image_words(uint32_t*, size_t, size_t, uint32_t*);
+
 void start_streaming_boot_reciver();
 
+int i3c_axi_stream_image(const void*, size_t);
+
 void i3c_init();
 
 void i3c_clear_dynamic_addr();
@@ -120,4 +202,16 @@ void i3c_read_rx_data(void*, size_t);
 
 void i3c_write_tx_data(const void*, size_t);
 
+void i3c_irq_init();
+
+int i3c_recv(void*, size_t);
+
+int i3c_send(const void*, size_t);
+
+void i3c_wait_for_msg();
+
+size_t i3c_tx_pending();
+
+uint32_t i3c_rx_dropped();
+
 #endif
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include "ipc.h"
+#include "pic.h"
+#include "utils.h"
+
+static uint32_t ipc_self;
+static volatile uint32_t ipc_pending;
+
+/* Stores to memory reach it before the accesses that follow, e.g. data handed
+   over before the doorbell announcing it. */
+static inline __attribute__((always_inline)) void ipc_fence()
+{
+	asm volatile ("fence" ::: "memory");
+}
+
+static void ipc_irq_handler()
+{
+	uint32_t bits = reg_read(IPC_BASE + IPC_DOORBELL_CLR(ipc_self));
+
+	/* Bits rung after the read stay set and raise the interrupt again. */
+	reg_write(IPC_BASE + IPC_DOORBELL_CLR(ipc_self), bits);
+	ipc_pending |= bits;
+}
+
+/* Must be called after pic_init(), with the index of the calling core. */
+void ipc_init(uint32_t self)
+{
+	ipc_self = self;
+	ipc_pending = 0;
+
+	/* Bells rung before, e.g. by the other core starting first, are kept and
+	   taken as soon as the interrupts are enabled. */
+	pic_register_irq(PIC_IRQ_IPC, ipc_irq_handler, 1);
+}
+
+void ipc_ring(uint32_t core, uint32_t bits)
+{
+	ipc_fence();
+	reg_write(IPC_BASE + IPC_DOORBELL(core), bits);
+}
+
+/* Takes the given bits if any of them was rung, without waiting. */
+uint32_t ipc_poll(uint32_t bits)
+{
+	uint32_t mstatus = csr_read(mstatus);
+	irq_disable();
+
+	bits &= ipc_pending;
+	ipc_pending &= ~bits;
+
+	if (mstatus & MSTATUS_MIE)
+		irq_enable();
+
+	return bits;
+}
+
+/* Sleeps until any of the given bits is rung and takes them. Enables the
+   interrupts. */
+uint32_t ipc_wait(uint32_t bits)
+{
+	while (1) {
+		irq_disable();
+		uint32_t rung = ipc_pending & bits;
+
+		if (rung) {
+			ipc_pending &= ~rung;
+			irq_enable();
+			ipc_fence();
+			return rung;
+		}
+
+		wait_for_interrupt();
+		irq_enable();
+	}
+}
+
+/* Returns 1 if the semaphore was free and is now taken by the caller. */
+int ipc_sem_trylock(uint32_t sem)
+{
+	if (reg_read(IPC_BASE + IPC_SEM(sem)))
+		return 0;
+
+	ipc_fence();
+	return 1;
+}
+
+void ipc_sem_lock(uint32_t sem)
+{
+	/* A release between the failed attempt and ipc_wait() leaves IPC_BELL_SEM
+	   pending, so the wakeup isn't lost. */
+	while (!ipc_sem_trylock(sem))
+		ipc_wait(IPC_BELL_SEM);
+}
+
+void ipc_sem_unlock(uint32_t sem)
+{
+	ipc_fence();
+	reg_write(IPC_BASE + IPC_SEM(sem), 0);
+
+	for (uint32_t core = 0; core < IPC_NUM_CORES; core++)
+		if (core != ipc_self)
+			reg_write(IPC_BASE + IPC_DOORBELL(core), IPC_BELL_SEM);
+}
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef IPC_H
+#define IPC_H
+
+#include <stdint.h>
+
+/* Inter-core semaphores and doorbells of the dualcore designs, see
+   design/src/guineveer_ipc.sv.
+
+   Every core has a 32-bit doorbell. Ringing it sets bits in it and raises the
+   doorbell interrupt of that core, whose handler moves the bits to a software
+   copy, so that ipc_wait() can sleep in wfi until one of the expected bits
+   arrives instead of polling over the shared bus. The meaning of the bits is up
+   to the firmware, except for IPC_BELL_SEM.
+
+   ipc_sem_lock() sleeps the same way between attempts to take a semaphore:
+   ipc_sem_unlock() rings IPC_BELL_SEM on the other cores. Semaphores aren't
+   owned, any core can free them. */
+
+#define IPC_BASE	(0x30002000)
+
+/* Memory shared by the cores (shmem in the dualcore designs), for data that
+   doesn't belong to either of them, e.g. the rings of the ring library. */
+#define IPC_SHMEM_BASE	(0xa0000000)
+#define IPC_SHMEM_SIZE	(0x8000)
+
+#define IPC_SEM(n)		(0x000 + 8 * (n))
+#define IPC_DOORBELL(c)		(0x100 + 8 * (c))
+#define IPC_DOORBELL_CLR(c)	(0x180 + 8 * (c))
+
+#define IPC_NUM_SEMS	(32)
+#define IPC_NUM_CORES	(2)
+
+/* Rung by ipc_sem_unlock(), free for the firmware otherwise. */
+#define IPC_BELL_SEM	(1u << 31)
+
+void ipc_init(uint32_t);
+
+void ipc_ring(uint32_t, uint32_t);
+
+uint32_t ipc_poll(uint32_t);
+
+uint32_t ipc_wait(uint32_t);
+
+int ipc_sem_trylock(uint32_t);
+
+void ipc_sem_lock(uint32_t);
+
+void ipc_sem_unlock(uint32_t);
+
+#endif
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include "log.h"
+#include "printf.h"
+
+uint32_t log_ring[LOG_RING_WORDS];
+volatile uint32_t log_ring_head;
+volatile uint32_t log_ring_tail;
+volatile uint32_t log_dropped_count;
+
+static uint32_t log_dropped_reported;
+
+static void log_put_word(uint32_t word)
+{
+	static const char hex[] = "0123456789abcdef";
+
+	_putchar(' ');
+	for (int shift = 28; shift >= 0; shift -= 4)
+		_putchar(hex[(word >> shift) & 0xf]);
+}
+
+void log_flush()
+{
+	/* Only this function consumes, so records can be read without masking
+	   interrupts; the tail is only advanced once a record has been sent. */
+	while (log_ring_tail != log_ring_head) {
+		uint32_t tail = log_ring_tail;
+		uint32_t words = 2 + (log_ring[tail & LOG_RING_MASK] & 0xff);
+
+		_putchar('@');
+		_putchar('L');
+		for (uint32_t i = 0; i < words; i++)
+			log_put_word(log_ring[(tail + i) & LOG_RING_MASK]);
+		_putchar('\r');
+		_putchar('\n');
+
+		asm volatile ("" ::: "memory");
+		log_ring_tail = tail + words;
+	}
+
+	/* The counter is only ever incremented by writers, report the records
+	   dropped since the last flush. */
+	uint32_t dropped = log_dropped_count;
+	if (dropped != log_dropped_reported) {
+		printf("@D %u\r\n", dropped - log_dropped_reported);
+		log_dropped_reported = dropped;
+	}
+}
+
+uint32_t log_dropped()
+{
+	return log_dropped_count;
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+#include "utils.h"
+#include "pic.h"
+
+/* Deferred binary logging.
+
+   LOG() doesn't format anything on the target. The format string is placed in
+   the non-loaded .log_fmt ELF section and a record with its offset in that
+   section, the mcycle timestamp and the raw 32-bit arguments is appended to a
+   RAM ring. log_flush() later drains the ring through _putchar() as lines of
+   hex words:
+
+       @L <offset << 8 | nargs> <mcycle> <arg>...
+
+   tests/sw/tools/logdecode.py turns them back into text using the .elf file.
+   Arguments are truncated to 32 bits; %s arguments must point to strings that
+   are part of the loaded image, as they are read back from the ELF. */
+
+/* Size of the record ring in words, must be a power of 2. */
+#ifndef LOG_RING_WORDS
+#define LOG_RING_WORDS 256
+#endif
+
+#define LOG_MAX_ARGS	(6)
+
+#define LOG_RING_MASK	(LOG_RING_WORDS - 1)
+
+extern uint32_t log_ring[LOG_RING_WORDS];
+extern volatile uint32_t log_ring_head;
+extern volatile uint32_t log_ring_tail;
+extern volatile uint32_t log_dropped_count;
+
+static inline __attribute__((always_inline)) void log_record(uint32_t id, const uint32_t *args,
+							       uint32_t nargs)
+{
+	/* Records may be written from interrupt handlers as well. */
+	uint32_t mstatus = csr_read(mstatus);
+	csr_clear(mstatus, MSTATUS_MIE);
+
+	uint32_t head = log_ring_head;
+
+	if (head - log_ring_tail + 2 + nargs > LOG_RING_WORDS) {
+		log_dropped_count++;
+	} else {
+		log_ring[head & LOG_RING_MASK] = (id << 8) | nargs;
+		log_ring[(head + 1) & LOG_RING_MASK] = csr_read(mcycle);
+		for (uint32_t i = 0; i < nargs; i++)
+			log_ring[(head + 2 + i) & LOG_RING_MASK] = args[i];
+		log_ring_head = head + 2 + nargs;
+	}
+
+	if (mstatus & MSTATUS_MIE)
+		csr_set(mstatus, MSTATUS_MIE);
+}
+
+/* Counts up to 12 arguments, so that passing more than LOG_MAX_ARGS is caught
+   by the assertion in LOG() instead of producing a wrong count. */
+#define __LOG_NARGS(...)	__LOG_NARGS_(0, ##__VA_ARGS__, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define __LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, n, ...)	n
+
+#define __LOG_CAT(a, b)		__LOG_CAT_(a, b)
+#define __LOG_CAT_(a, b)	a##b
+
+#define __LOG_ARGS0()
+#define __LOG_ARGS1(a)		(uint32_t)(a)
+#define __LOG_ARGS2(a, ...)	(uint32_t)(a), __LOG_ARGS1(__VA_ARGS__)
+#define __LOG_ARGS3(a, ...)	(uint32_t)(a), __LOG_ARGS2(__VA_ARGS__)
+#define __LOG_ARGS4(a, ...)	(uint32_t)(a), __LOG_ARGS3(__VA_ARGS__)
+#define __LOG_ARGS5(a, ...)	(uint32_t)(a), __LOG_ARGS4(__VA_ARGS__)
+#define __LOG_ARGS6(a, ...)	(uint32_t)(a), __LOG_ARGS5(__VA_ARGS__)
+
+/* Log a printf-style message with up to LOG_MAX_ARGS integer, character,
+   pointer or constant string arguments. */
+#define LOG(fmt, ...) do { \
+	_Static_assert(__LOG_NARGS(__VA_ARGS__) <= LOG_MAX_ARGS, "too many LOG() arguments"); \
+	static const char __log_fmt[] __attribute__((section(".log_fmt"))) = fmt; \
+	const uint32_t __log_args[] = { 0, __LOG_CAT(__LOG_ARGS, __LOG_NARGS(__VA_ARGS__))(__VA_ARGS__) }; \
+	log_record((uint32_t)__log_fmt, __log_args + 1, __LOG_NARGS(__VA_ARGS__)); \
+} while (0)
+
+void log_flush();
+
+uint32_t log_dropped();
+
+#endif
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include "perf.h"
+#include "pic.h"
+#include "printf.h"
+
+/* Events counted after perf_init(): why instructions aren't being fetched, how
+   often and how long the core waits for its data bus, and mispredictions. */
+static const uint32_t perf_default_events[PERF_COUNTERS] = {
+	PERF_EV_FETCH_STALLS,
+	PERF_EV_DBUS_TRANSACTIONS,
+	PERF_EV_DBUS_BUSY_STALLS,
+	PERF_EV_BRANCH_MISPREDICTS,
+};
+
+static uint32_t perf_events[PERF_COUNTERS];
+static struct perf_region *perf_regions;
+
+static const char *perf_event_name(uint32_t event)
+{
+	switch (event) {
+	case PERF_EV_CYCLES: return "active_cycles";
+	case PERF_EV_ICACHE_HITS: return "icache_hits";
+	case PERF_EV_ICACHE_MISSES: return "icache_misses";
+	case PERF_EV_INSTR: return "instr";
+	case PERF_EV_MULS: return "muls";
+	case PERF_EV_DIVS: return "divs";
+	case PERF_EV_LOADS: return "loads";
+	case PERF_EV_STORES: return "stores";
+	case PERF_EV_MISALIGNED_LOADS: return "misaligned_loads";
+	case PERF_EV_MISALIGNED_STORES: return "misaligned_stores";
+	case PERF_EV_BRANCHES: return "branches";
+	case PERF_EV_BRANCH_MISPREDICTS: return "mispredicts";
+	case PERF_EV_BRANCHES_TAKEN: return "branches_taken";
+	case PERF_EV_FETCH_STALLS: return "fetch_stalls";
+	case PERF_EV_DECODE_STALLS: return "decode_stalls";
+	case PERF_EV_POSTSYNC_STALLS: return "postsync_stalls";
+	case PERF_EV_PRESYNC_STALLS: return "presync_stalls";
+	case PERF_EV_STORE_STALLS: return "store_stalls";
+	case PERF_EV_EXCEPTIONS: return "exceptions";
+	case PERF_EV_TIMER_IRQS: return "timer_irqs";
+	case PERF_EV_EXT_IRQS: return "ext_irqs";
+	case PERF_EV_FLUSHES: return "flushes";
+	case PERF_EV_IBUS_TRANSACTIONS: return "ibus_trans";
+	case PERF_EV_DBUS_TRANSACTIONS: return "dbus_trans";
+	case PERF_EV_DBUS_MISALIGNED: return "dbus_misaligned";
+	case PERF_EV_IBUS_BUSY_STALLS: return "ibus_busy";
+	case PERF_EV_DBUS_BUSY_STALLS: return "dbus_busy";
+	case PERF_EV_IRQS_DISABLED: return "irqs_disabled";
+	case PERF_EV_SLEEP_CYCLES: return "sleep_cycles";
+	default: return NULL;
+	}
+}
+
+/* Changing the events makes the totals meaningless, so they are reset too. */
+void perf_select(const uint32_t *events)
+{
+	for (int i = 0; i < PERF_COUNTERS; i++)
+		perf_events[i] = events[i];
+
+	csr_write(mhpmevent3, perf_events[0]);
+	csr_write(mhpmevent4, perf_events[1]);
+	csr_write(mhpmevent5, perf_events[2]);
+	csr_write(mhpmevent6, perf_events[3]);
+
+	perf_reset();
+}
+
+void perf_init()
+{
+	perf_select(perf_default_events);
+}
+
+void perf_reset()
+{
+	for (struct perf_region *r = perf_regions; r; r = r->next) {
+		r->count = 0;
+		r->total = (struct perf_counters){ 0 };
+	}
+}
+
+void perf_region_start(struct perf_region *r)
+{
+	if (!r->registered) {
+		/* Regions may first run in an interrupt handler. */
+		uint32_t mstatus = csr_read(mstatus);
+		csr_clear(mstatus, MSTATUS_MIE);
+
+		r->next = perf_regions;
+		perf_regions = r;
+		r->registered = 1;
+
+		if (mstatus & MSTATUS_MIE)
+			csr_set(mstatus, MSTATUS_MIE);
+	}
+
+	perf_snapshot(&r->start);
+}
+
+void perf_region_stop(struct perf_region *r)
+{
+	struct perf_counters end;
+
+	perf_snapshot(&end);
+
+	r->total.cycles += end.cycles - r->start.cycles;
+	r->total.instret += end.instret - r->start.instret;
+	for (int i = 0; i < PERF_COUNTERS; i++)
+		r->total.events[i] += end.events[i] - r->start.events[i];
+	r->count++;
+}
+
+struct perf_region *perf_region_begin(struct perf_region *r)
+{
+	perf_region_start(r);
+	return r;
+}
+
+void perf_region_end(struct perf_region **r)
+{
+	perf_region_stop(*r);
+}
+
+void perf_dump()
+{
+	for (struct perf_region *r = perf_regions; r; r = r->next) {
+		printf("@P name=%s count=%u cycles=%u instret=%u", r->name, r->count,
+		       r->total.cycles, r->total.instret);
+
+		for (int i = 0; i < PERF_COUNTERS; i++) {
+			const char *name = perf_event_name(perf_events[i]);
+
+			if (name)
+				printf(" %s=%u", name, r->total.events[i]);
+			else if (perf_events[i])
+				printf(" ev%u=%u", perf_events[i], r->total.events[i]);
+		}
+
+		printf("\r\n");
+	}
+}
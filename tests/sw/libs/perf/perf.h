@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef PERF_H
+#define PERF_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "utils.h"
+
+/* Hardware performance counters.
+
+   VeeR EL2 has four programmable counters, mhpmcounter3-6, counting the events
+   selected in mhpmevent3-6. perf_select() programs them and PERF_REGION() marks
+   a region of code whose mcycle, minstret and event counts are accumulated over
+   all its executions:
+
+       void i3c_drain_rx()
+       {
+           PERF_REGION("i3c_rx");
+           ...
+       }
+
+   The region ends when the enclosing scope is left. perf_dump() prints the
+   totals of every region executed so far through _putchar(), one line each:
+
+       @P name=<name> count=<n> cycles=<c> instret=<i> <event>=<count>...
+
+   Regions may nest, but a region must not be re-entered, e.g. from an interrupt
+   handler while the code it covers runs. Building with -DPERF_DISABLE removes
+   them. The counters are 32-bit and wrap after about 2^32 cycles. */
+
+#define PERF_COUNTERS	(4)
+
+/* mhpmevent values, see the VeeR EL2 programmer's reference manual for the
+   full list. */
+enum perf_event {
+	PERF_EV_NONE			= 0,
+	PERF_EV_CYCLES			= 1,
+	PERF_EV_ICACHE_HITS		= 2,
+	PERF_EV_ICACHE_MISSES		= 3,
+	PERF_EV_INSTR			= 4,
+	PERF_EV_MULS			= 9,
+	PERF_EV_DIVS			= 10,
+	PERF_EV_LOADS			= 11,
+	PERF_EV_STORES			= 12,
+	PERF_EV_MISALIGNED_LOADS	= 13,
+	PERF_EV_MISALIGNED_STORES	= 14,
+	PERF_EV_BRANCHES		= 24,
+	PERF_EV_BRANCH_MISPREDICTS	= 25,
+	PERF_EV_BRANCHES_TAKEN		= 26,
+	PERF_EV_FETCH_STALLS		= 28,
+	PERF_EV_DECODE_STALLS		= 30,
+	PERF_EV_POSTSYNC_STALLS		= 31,
+	PERF_EV_PRESYNC_STALLS		= 32,
+	PERF_EV_STORE_STALLS		= 34,
+	PERF_EV_EXCEPTIONS		= 37,
+	PERF_EV_TIMER_IRQS		= 38,
+	PERF_EV_EXT_IRQS		= 39,
+	PERF_EV_FLUSHES			= 40,
+	PERF_EV_IBUS_TRANSACTIONS	= 42,
+	PERF_EV_DBUS_TRANSACTIONS	= 43,
+	PERF_EV_DBUS_MISALIGNED		= 44,
+	PERF_EV_IBUS_BUSY_STALLS	= 47,
+	PERF_EV_DBUS_BUSY_STALLS	= 48,
+	PERF_EV_IRQS_DISABLED		= 49,
+	PERF_EV_SLEEP_CYCLES		= 512,
+};
+
+struct perf_counters {
+	uint32_t cycles;
+	uint32_t instret;
+	uint32_t events[PERF_COUNTERS];
+};
+
+struct perf_region {
+	const char *name;
+	struct perf_region *next;
+	int registered;
+	uint32_t count;
+	struct perf_counters start;
+	struct perf_counters total;
+};
+
+static inline __attribute__((always_inline)) void perf_snapshot(struct perf_counters *c)
+{
+	c->cycles = csr_read(mcycle);
+	c->instret = csr_read(minstret);
+	c->events[0] = csr_read(mhpmcounter3);
+	c->events[1] = csr_read(mhpmcounter4);
+	c->events[2] = csr_read(mhpmcounter5);
+	c->events[3] = csr_read(mhpmcounter6);
+}
+
+void perf_select(const uint32_t*);
+
+void perf_init();
+
+void perf_reset();
+
+void perf_region_start(struct perf_region*);
+
+void perf_region_stop(struct perf_region*);
+
+struct perf_region *perf_region_begin(struct perf_region*);
+
+void perf_region_end(struct perf_region**);
+
+void perf_dump();
+
+#define __PERF_CAT(a, b)	__PERF_CAT_(a, b)
+#define __PERF_CAT_(a, b)	a##b
+
+#ifdef PERF_DISABLE
+#define PERF_REGION(label)	do { } while (0)
+#else
+#define PERF_REGION(label) \
+	static struct perf_region __PERF_CAT(__perf_region_, __LINE__) = { .name = (label) }; \
+	struct perf_region *__PERF_CAT(__perf_scope_, __LINE__) \
+		__attribute__((cleanup(perf_region_end), unused)) = \
+		perf_region_begin(&__PERF_CAT(__perf_region_, __LINE__))
+#endif
+
+#endif
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include "pic.h"
+
+static pic_handler_t pic_handlers[PIC_TOTAL_INT + 1];
+
+static void __attribute__((interrupt("machine"), aligned(4))) trap_handler()
+{
+	uint32_t cause = csr_read(mcause);
+
+	/* Only external interrupts are expected, hang on anything else. */
+	if (cause != (MCAUSE_INTERRUPT | MCAUSE_MEI))
+		while (1)
+			;
+
+	/* Capture the highest-priority pending source and claim it. */
+	csr_write(CSR_MEICPCT, 0);
+	uint32_t id = (csr_read(CSR_MEIHAP) >> 2) & 0xff;
+
+	if (id > 0 && id <= PIC_TOTAL_INT && pic_handlers[id])
+		pic_handlers[id]();
+}
+
+void pic_init()
+{
+	irq_disable();
+
+	/* Standard priority order, nothing masked by the threshold. */
+	reg_write(PIC_BASE + PIC_MPICCFG, 0);
+	csr_write(CSR_MEIPT, 0);
+	csr_write(CSR_MEICIDPL, 0);
+	csr_write(CSR_MEICURPL, 0);
+
+	for (uint32_t id = 1; id <= PIC_TOTAL_INT; id++) {
+		reg_write(PIC_BASE + PIC_MEIE(id), 0);
+		reg_write(PIC_BASE + PIC_MEIPL(id), 0);
+		/* All Guineveer sources are active-high and level-triggered. */
+		reg_write(PIC_BASE + PIC_MEIGWCTRL(id), 0);
+		reg_write(PIC_BASE + PIC_MEIGWCLR(id), 0);
+		pic_handlers[id] = 0;
+	}
+
+	csr_write(mtvec, (uint32_t)trap_handler);
+	csr_set(mie, MIE_MEIE);
+}
+
+void pic_register_irq(uint32_t id, pic_handler_t handler, uint32_t priority)
+{
+	if (id == 0 || id > PIC_TOTAL_INT)
+		return;
+
+	pic_handlers[id] = handler;
+	reg_write(PIC_BASE + PIC_MEIPL(id), priority > PIC_PRIORITY_MAX ? PIC_PRIORITY_MAX : priority);
+	reg_write(PIC_BASE + PIC_MEIE(id), 1);
+}
+
+void pic_unregister_irq(uint32_t id)
+{
+	if (id == 0 || id > PIC_TOTAL_INT)
+		return;
+
+	reg_write(PIC_BASE + PIC_MEIE(id), 0);
+	pic_handlers[id] = 0;
+}
+
+void irq_enable()
+{
+	csr_set(mstatus, MSTATUS_MIE);
+}
+
+void irq_disable()
+{
+	csr_clear(mstatus, MSTATUS_MIE);
+}
+
+void wait_for_interrupt()
+{
+	/* A pending interrupt wakes the core up even with MIE cleared, so callers
+	   can check their condition with interrupts disabled and sleep without
+	   missing a wakeup. The interrupt is taken once MIE is set again. */
+	asm volatile ("wfi");
+}
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef PIC_H
+#define PIC_H
+
+#include <stdint.h>
+#include "utils.h"
+
+/* ---------- VeeR PIC ---------- */
+
+#define PIC_BASE	(0xf00c0000)
+
+#define PIC_MEIPL(s)		(0x0000 + 4 * (s))
+#define PIC_MEIP		(0x1000)
+#define PIC_MEIE(s)		(0x2000 + 4 * (s))
+#define PIC_MPICCFG		(0x3000)
+#define  PIC_MPICCFG_PRIORD_REVERSE	(1 << 0)
+#define PIC_MEIGWCTRL(s)	(0x4000 + 4 * (s))
+#define  PIC_MEIGWCTRL_POLARITY_LOW	(1 << 0)
+#define  PIC_MEIGWCTRL_TYPE_EDGE	(1 << 1)
+#define PIC_MEIGWCLR(s)		(0x5000 + 4 * (s))
+
+#define PIC_TOTAL_INT		(8)
+#define PIC_PRIORITY_MAX	(15)
+
+/* External interrupt sources, must match the mapping in irq_aggregator.sv. */
+#define PIC_IRQ_I3C		(1)
+#define PIC_IRQ_UART		(2)
+#define PIC_IRQ_IPC		(3)
+
+/* VeeR-specific CSRs. */
+#define CSR_MEIVT	0xbc8
+#define CSR_MEIPT	0xbc9
+#define CSR_MEICPCT	0xbca
+#define CSR_MEICIDPL	0xbcb
+#define CSR_MEICURPL	0xbcc
+#define CSR_MEIHAP	0xfc8
+
+#define MSTATUS_MIE	(1 << 3)
+#define MIE_MEIE	(1 << 11)
+#define MCAUSE_INTERRUPT	(1u << 31)
+#define MCAUSE_MEI	(11)
+
+typedef void (*pic_handler_t)(void);
+
+void pic_init();
+
+void pic_register_irq(uint32_t, pic_handler_t, uint32_t);
+
+void pic_unregister_irq(uint32_t);
+
+void irq_enable();
+
+void irq_disable();
+
+void wait_for_interrupt();
+
+#endif
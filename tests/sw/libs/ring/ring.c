@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include <string.h>
+#include "ring.h"
+#include "ipc.h"
+
+/* The producer uses head as its index and tail as the cached index of the
+   consumer, the consumer the other way round. */
+
+static int ring_init(struct ring *r, void *mem, uint32_t size)
+{
+	if (size < 8 || (size & (size - 1)) || ((uintptr_t)mem & 7))
+		return -1;
+
+	r->shared = mem;
+	r->mask = size - 1;
+	r->notify_bits = 0;
+
+	return 0;
+}
+
+int ring_create(struct ring *r, void *mem, uint32_t size)
+{
+	if (ring_init(r, mem, size))
+		return -1;
+
+	r->shared->head = r->head = 0;
+	r->shared->tail = r->tail = 0;
+
+	return 0;
+}
+
+int ring_attach(struct ring *r, void *mem, uint32_t size)
+{
+	if (ring_init(r, mem, size))
+		return -1;
+
+	r->head = r->shared->head;
+	r->tail = r->shared->tail;
+
+	return 0;
+}
+
+void ring_set_notify(struct ring *r, uint32_t core, uint32_t bits)
+{
+	r->notify_core = core;
+	r->notify_bits = bits;
+}
+
+/* Makes the accesses to the data visible to the other core before the index
+   that hands it over. */
+static void ring_publish(struct ring *r, volatile uint32_t *index, uint32_t value)
+{
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	*index = value;
+
+	if (r->notify_bits)
+		ipc_ring(r->notify_core, r->notify_bits);
+}
+
+/* Keeps the accesses to the data after the load of the other core's index
+   that handed it over, pairs with the fence in ring_publish(). */
+static void ring_acquire(void)
+{
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+
+size_t ring_write_span(struct ring *r, void **span)
+{
+	uint32_t size = r->mask + 1;
+
+	if (r->head - r->tail == size) {
+		r->tail = r->shared->tail;
+		ring_acquire();
+	}
+
+	uint32_t free = size - (r->head - r->tail);
+	uint32_t to_end = size - (r->head & r->mask);
+
+	*span = &r->shared->data[r->head & r->mask];
+	return free < to_end ? free : to_end;
+}
+
+void ring_produce(struct ring *r, size_t len)
+{
+	r->head += len;
+	ring_publish(r, &r->shared->head, r->head);
+}
+
+size_t ring_read_span(struct ring *r, const void **span)
+{
+	uint32_t size = r->mask + 1;
+
+	if (r->head == r->tail) {
+		r->head = r->shared->head;
+		ring_acquire();
+	}
+
+	uint32_t used = r->head - r->tail;
+	uint32_t to_end = size - (r->tail & r->mask);
+
+	*span = &r->shared->data[r->tail & r->mask];
+	return used < to_end ? used : to_end;
+}
+
+void ring_consume(struct ring *r, size_t len)
+{
+	r->tail += len;
+	ring_publish(r, &r->shared->tail, r->tail);
+}
+
+/* Copies up to len bytes into the ring, the part after the wrap included, and
+   publishes them at once. Returns the number of bytes written. */
+size_t ring_write(struct ring *r, const void *buf, size_t len)
+{
+	const uint8_t *rd = buf;
+	size_t done = 0;
+
+	while (done < len) {
+		void *span;
+		size_t count = ring_write_span(r, &span);
+
+		if (!count)
+			break;
+		if (count > len - done)
+			count = len - done;
+
+		memcpy(span, rd + done, count);
+		r->head += count;
+		done += count;
+	}
+
+	if (done)
+		ring_publish(r, &r->shared->head, r->head);
+
+	return done;
+}
+
+/* Copies up to len bytes out of the ring and frees them at once. Returns the
+   number of bytes read. */
+size_t ring_read(struct ring *r, void *buf, size_t len)
+{
+	uint8_t *wr = buf;
+	size_t done = 0;
+
+	while (done < len) {
+		const void *span;
+		size_t count = ring_read_span(r, &span);
+
+		if (!count)
+			break;
+		if (count > len - done)
+			count = len - done;
+
+		memcpy(wr + done, span, count);
+		r->tail += count;
+		done += count;
+	}
+
+	if (done)
+		ring_publish(r, &r->shared->tail, r->tail);
+
+	return done;
+}
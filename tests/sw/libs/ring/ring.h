@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef RING_H
+#define RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Single-producer, single-consumer byte ring between the cores, without locks.
+
+   The ring lives in memory both cores can reach, e.g. IPC_SHMEM_BASE:
+
+       head   written by the producer only, one 8-byte bus word
+       tail   written by the consumer only, the next bus word
+       data   RING_SIZE bytes, a power of two
+
+   head and tail count bytes from the creation of the ring and wrap at 2^32.
+   Every core keeps its own struct ring with its index and the last value of
+   the other one it has read, which is only read again from the shared memory
+   when the cached value says the ring is full (or empty). A batch of any size
+   is then published with a single store of the index.
+
+   The producer calls ring_create() before telling the consumer about the ring,
+   which then calls ring_attach(). ring_write_span()/ring_read_span() return the
+   contiguous part of the ring that can be written or read in place, and
+   ring_produce()/ring_consume() publish how much of it was used; ring_write()
+   and ring_read() copy through them.
+
+   With ring_set_notify(), publishing also rings the given doorbell bits on the
+   other core (see ipc.h), so that a consumer waiting for data or a producer
+   waiting for space can sleep in ipc_wait() instead of polling the shared
+   memory:
+
+       while (!(n = ring_read(&r, buf, sizeof(buf))))
+           ipc_wait(BELL_DATA); */
+
+struct ring_shared {
+	volatile uint32_t head __attribute__((aligned(8)));
+	volatile uint32_t tail __attribute__((aligned(8)));
+	uint8_t data[] __attribute__((aligned(8)));
+};
+
+struct ring {
+	struct ring_shared *shared;
+	uint32_t mask;
+	uint32_t head;
+	uint32_t tail;
+	uint32_t notify_core;
+	uint32_t notify_bits;
+};
+
+/* Bytes taken by a ring with the given amount of data in the shared memory. */
+#define RING_FOOTPRINT(size)	(sizeof(struct ring_shared) + (size))
+
+int ring_create(struct ring*, void*, uint32_t);
+
+int ring_attach(struct ring*, void*, uint32_t);
+
+void ring_set_notify(struct ring*, uint32_t, uint32_t);
+
+size_t ring_write_span(struct ring*, void**);
+
+void ring_produce(struct ring*, size_t);
+
+size_t ring_read_span(struct ring*, const void**);
+
+void ring_consume(struct ring*, size_t);
+
+size_t ring_write(struct ring*, const void*, size_t);
+
+size_t ring_read(struct ring*, void*, size_t);
+
+#endif
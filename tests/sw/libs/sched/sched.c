@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include <setjmp.h>
+#include "sched.h"
+#include "utils.h"
+
+enum sched_state {
+	SCHED_FREE,
+	SCHED_NEW,
+	SCHED_READY,
+	SCHED_WAITING,
+	SCHED_DONE,
+};
+
+struct sched_task {
+	jmp_buf ctx;
+	enum sched_state state;
+	sched_task_fn fn;
+	void *arg;
+	uintptr_t stack_top;
+
+	/* Register condition a SCHED_WAITING task is blocked on. */
+	uint32_t wait_addr;
+	uint32_t wait_mask;
+	uint32_t wait_value;
+	int wait_any;
+};
+
+static struct sched_task sched_tasks[SCHED_MAX_TASKS] = {
+	[0] = { .state = SCHED_READY },
+};
+static int sched_cur;
+static void (*sched_idle_hook)(void);
+
+static int sched_runnable(struct sched_task *task)
+{
+	if (task->state == SCHED_NEW || task->state == SCHED_READY)
+		return 1;
+
+	if (task->state != SCHED_WAITING)
+		return 0;
+
+	uint32_t val = reg_read(task->wait_addr) & task->wait_mask;
+	if (task->wait_any ? !val : val != task->wait_value)
+		return 0;
+
+	task->state = SCHED_READY;
+	return 1;
+}
+
+/* Picks the next runnable task after the current one, the current one last.
+   Runs the idle hook whenever every task is blocked. */
+static int sched_pick_next()
+{
+	while (1) {
+		for (int i = 1; i <= SCHED_MAX_TASKS; i++) {
+			int idx = (sched_cur + i) % SCHED_MAX_TASKS;
+
+			if (sched_runnable(&sched_tasks[idx]))
+				return idx;
+		}
+
+		if (sched_idle_hook)
+			sched_idle_hook();
+	}
+}
+
+static void sched_task_entry()
+{
+	struct sched_task *task = &sched_tasks[sched_cur];
+
+	task->fn(task->arg);
+
+	/* Tasks have nothing to return to, switch away for good. */
+	task->state = SCHED_DONE;
+	sched_yield();
+	__builtin_unreachable();
+}
+
+int sched_spawn(sched_task_fn fn, void *arg, void *stack, size_t stack_size)
+{
+	for (int i = 1; i < SCHED_MAX_TASKS; i++) {
+		struct sched_task *task = &sched_tasks[i];
+
+		if (task->state != SCHED_FREE && task->state != SCHED_DONE)
+			continue;
+
+		task->fn = fn;
+		task->arg = arg;
+		/* The ABI requires a 16-byte aligned stack pointer. */
+		task->stack_top = ((uintptr_t)stack + stack_size) & ~(uintptr_t)0xf;
+		task->state = SCHED_NEW;
+
+		return i;
+	}
+
+	return -1;
+}
+
+void sched_yield()
+{
+	int next = sched_pick_next();
+
+	if (next == sched_cur)
+		return;
+
+	if (setjmp(sched_tasks[sched_cur].ctx))
+		return;
+
+	sched_cur = next;
+
+	if (sched_tasks[next].state == SCHED_NEW) {
+		sched_tasks[next].state = SCHED_READY;
+
+		/* Start the task on its own stack. */
+		asm volatile (
+			     "mv sp, %0" "\n"
+			"\t" "jr %1"
+			     :
+			     : "r"(sched_tasks[next].stack_top), "r"(sched_task_entry)
+			     : "memory");
+		__builtin_unreachable();
+	}
+
+	longjmp(sched_tasks[next].ctx, 1);
+}
+
+static void sched_wait(uint32_t addr, uint32_t mask, uint32_t value, int any)
+{
+	struct sched_task *task = &sched_tasks[sched_cur];
+
+	task->wait_addr = addr;
+	task->wait_mask = mask;
+	task->wait_value = value;
+	task->wait_any = any;
+	task->state = SCHED_WAITING;
+
+	/* Returns once the scheduler has seen the condition met. */
+	if (!sched_runnable(task))
+		sched_yield();
+}
+
+void sched_wait_reg(uint32_t addr, uint32_t mask, uint32_t value)
+{
+	sched_wait(addr, mask, value, 0);
+}
+
+void sched_wait_reg_any(uint32_t addr, uint32_t mask)
+{
+	sched_wait(addr, mask, 0, 1);
+}
+
+void sched_set_idle_hook(void (*hook)(void))
+{
+	sched_idle_hook = hook;
+}
+
+void sched_idle_wfi()
+{
+	/* Only useful once the awaited events raise interrupts, otherwise the core
+	   sleeps forever. */
+	asm volatile ("wfi");
+}
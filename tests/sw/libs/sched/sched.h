@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Cooperative round-robin scheduler. The code that spawns the first task
+   becomes task 0 and keeps running on its original stack. Tasks only switch
+   in sched_yield() and the sched_wait_*() calls, so no locking is needed
+   between them. */
+
+#ifndef SCHED_MAX_TASKS
+#define SCHED_MAX_TASKS 4
+#endif
+
+typedef void (*sched_task_fn)(void*);
+
+int sched_spawn(sched_task_fn, void*, void*, size_t);
+
+void sched_yield();
+
+void sched_wait_reg(uint32_t, uint32_t, uint32_t);
+
+void sched_wait_reg_any(uint32_t, uint32_t);
+
+void sched_set_idle_hook(void (*)(void));
+
+void sched_idle_wfi();
+
+#endif
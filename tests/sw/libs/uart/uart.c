@@ -1,42 +1,322 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (c) 2025-2026 Antmicro <www.antmicro.com>
 
+#include <string.h>
 #include "uart.h"
+#include "pic.h"
 
 void uart_init(uint64_t baud)
 {
 	uint64_t nco = (baud << 20) / SOC_CLOCK_HZ;
 
-	/* Set baudrate, enable TX, RX */
-	write32(UART_BASE + UART_CTRL_REG,
-		(nco << UART_CTRL_NCO_OFFSET) | UART_CTRL_TX_EN | UART_CTRL_RX_EN);
-	/* Reset FIFOs */
-	write32(UART_BASE + UART_FIFO_CTRL_REG,
-		UART_FIFO_CTRL_RXRST | UART_FIFO_CTRL_TXRST);
+	/* Set baudrate, enable TX, RX, then reset FIFOs */
+	REG_WRITE_SEQ(UART_BASE,
+		{ offsetof(UART_t, CTRL),
+		  REG_FIELD_PREP(UART__CTRL__NCO, nco) | UART__CTRL__TX_bm | UART__CTRL__RX_bm },
+		{ offsetof(UART_t, FIFO_CTRL),
+		  UART__FIFO_CTRL__RXRST_bm | UART__FIFO_CTRL__TXRST_bm });
 }
 
 int uart_tx_rdy(void)
 {
-	return (read32(UART_BASE + UART_STATUS_REG) & UART_STATUS_TX_IDLE) > 0;
+	return REG_READ_FIELD(UART_REG(STATUS), UART__STATUS__TXIDLE);
 }
 
 int uart_rx_empty(void)
 {
-	return (read32(UART_BASE + UART_FIFO_STATUS_REG) & UART_FIFO_STATUS_RXLVL_MASK) == 0;
+	return REG_READ_FIELD(UART_REG(FIFO_STATUS), UART__FIFO_STATUS__RXLVL) == 0;
 }
 
-void _putchar(char character)
+static int uart_irq_active;
+
+static void uart_drain_tx_ring();
+
+void uart_write(const void *buf, size_t len)
 {
+	const uint8_t *rd = buf;
+
+	/* Once the interrupt-driven driver owns the TX FIFO, queue behind
+	   whatever uart_send() has pending instead of racing the ISR for the
+	   FIFO space. uart_send() refills the FIFO itself, so this also makes
+	   progress with interrupts masked. */
+	if (uart_irq_active) {
+		while (len) {
+			size_t count = uart_send(rd, len);
+
+			rd += count;
+			len -= count;
+		}
+		return;
+	}
+
+	/* Keep the TX FIFO topped up instead of waiting for it to drain, so the
+	   line stays busy and we only stall while the FIFO is full. */
+	while (len) {
+		uint32_t level = REG_READ_FIELD(UART_REG(FIFO_STATUS), UART__FIFO_STATUS__TXLVL);
+		size_t room = level < UART_TX_FIFO_DEPTH ? UART_TX_FIFO_DEPTH - level : 0;
+
+		if (room > len)
+			room = len;
+		len -= room;
+
+		while (room--)
+			reg_write(UART_REG(WDATA), *rd++);
+	}
+}
+
+void uart_flush(void)
+{
+	if (uart_irq_active)
+		uart_drain_tx_ring();
+
+	/* TX idle is only set once the FIFO is empty and the last character has
+	   left the shift register. */
 	while (!uart_tx_rdy())
 		;
+}
 
-	write32(UART_BASE + UART_WDATA_REG, character);
+/* Weak, so that a different console backend can be linked in instead (see
+   CONSOLE in common.mk). */
+__attribute__((weak)) void _putchar(char character)
+{
+	uart_write(&character, 1);
 }
 
 int getchar()
 {
+	if (uart_irq_active) {
+		char c;
+
+		while (!uart_recv(&c, 1))
+			;
+		return (uint8_t)c;
+	}
+
 	while (uart_rx_empty())
 		;
 
-	return read32(UART_BASE + UART_RDATA_REG) & 0xFF;
+	return REG_READ_FIELD(UART_REG(RDATA), UART__RDATA__RDATA);
+}
+
+/* ---------- Interrupt-driven driver ---------- */
+
+#define UART_RING_MASK	(UART_RING_SIZE - 1)
+
+/* Free-running indices: the producer only advances head and the consumer only
+   advances tail. The ISR produces RX and consumes TX. */
+struct uart_ring {
+	volatile uint32_t head;
+	volatile uint32_t tail;
+	uint8_t data[UART_RING_SIZE];
+};
+
+static struct uart_ring uart_rx_ring;
+static struct uart_ring uart_tx_ring;
+
+/* RX ring position just past the last complete line, i.e. the last newline or
+   the last byte before the line went idle for the RX timeout. */
+static volatile uint32_t uart_rx_line_end;
+static volatile uint32_t uart_rx_overflow_count;
+
+static uint32_t uart_rx_level()
+{
+	return REG_READ_FIELD(UART_REG(FIFO_STATUS), UART__FIFO_STATUS__RXLVL);
+}
+
+static void uart_drain_rx(uint32_t keep)
+{
+	uint32_t level;
+
+	while ((level = uart_rx_level()) > keep) {
+		for (level -= keep; level; level--) {
+			uint8_t c = REG_READ_FIELD(UART_REG(RDATA), UART__RDATA__RDATA);
+
+			if (uart_rx_ring.head - uart_rx_ring.tail == UART_RING_SIZE) {
+				uart_rx_overflow_count++;
+				continue;
+			}
+
+			uart_rx_ring.data[uart_rx_ring.head & UART_RING_MASK] = c;
+			uart_rx_ring.head++;
+			if (c == '\n')
+				uart_rx_line_end = uart_rx_ring.head;
+		}
+	}
+}
+
+static void uart_refill_tx()
+{
+	uint32_t level = REG_READ_FIELD(UART_REG(FIFO_STATUS), UART__FIFO_STATUS__TXLVL);
+
+	for (; level < UART_TX_FIFO_DEPTH && uart_tx_ring.tail != uart_tx_ring.head; level++) {
+		reg_write(UART_REG(WDATA), uart_tx_ring.data[uart_tx_ring.tail & UART_RING_MASK]);
+		uart_tx_ring.tail++;
+	}
+
+	/* The watermark interrupt is only needed while there is more to send. */
+	REG_UPDATE_FIELD(UART_REG(INTR_ENABLE), UART__INTR_ENABLE__TX_WATERMARK,
+			 uart_tx_ring.tail != uart_tx_ring.head);
+}
+
+/* Pushes the TX ring out to the FIFO without relying on the watermark
+   interrupt, which may be masked by the caller. */
+static void uart_drain_tx_ring()
+{
+	while (uart_tx_ring.tail != uart_tx_ring.head) {
+		uint32_t mstatus = csr_read(mstatus);
+		irq_disable();
+
+		uart_refill_tx();
+
+		if (mstatus & MSTATUS_MIE)
+			irq_enable();
+	}
+}
+
+static void uart_irq_handler()
+{
+	uint32_t status = reg_read(UART_REG(INTR_STATE));
+
+	/* Acknowledge the events before handling them, so that new ones raised
+	   while draining are not lost. */
+	reg_write(UART_REG(INTR_STATE), status);
+
+	if (status & UART__INTR_STATE__RX_OVERFLOW_bm)
+		uart_rx_overflow_count++;
+
+	if (status & UART__INTR_STATE__RX_TIMEOUT_bm) {
+		/* The line went idle, whatever arrived so far completes a line. */
+		uart_drain_rx(0);
+		uart_rx_line_end = uart_rx_ring.head;
+	} else if (status & UART__INTR_STATE__RX_WATERMARK_bm) {
+		/* The RX timeout only fires while the FIFO holds data, so leave the
+		   last character in it for a burst that ends right at the
+		   watermark to still be closed by the timeout. */
+		uart_drain_rx(1);
+	}
+
+	if (status & UART__INTR_STATE__TX_WATERMARK_bm)
+		uart_refill_tx();
+}
+
+void uart_irq_init(uint32_t rxilvl, uint32_t txilvl, uint32_t timeout_bits)
+{
+	uart_rx_ring.head = uart_rx_ring.tail = 0;
+	uart_tx_ring.head = uart_tx_ring.tail = 0;
+	uart_rx_line_end = 0;
+	uart_rx_overflow_count = 0;
+
+	reg_update(UART_REG(FIFO_CTRL),
+		   REG_FIELD_MASK(UART__FIFO_CTRL__RXILVL) | REG_FIELD_MASK(UART__FIFO_CTRL__TXILVL),
+		   REG_FIELD_PREP(UART__FIFO_CTRL__RXILVL, rxilvl) |
+		   REG_FIELD_PREP(UART__FIFO_CTRL__TXILVL, txilvl));
+
+	REG_WRITE_SEQ(UART_BASE,
+		{ offsetof(UART_t, TIMEOUT_CTRL),
+		  REG_FIELD_PREP(UART__TIMEOUT_CTRL__VAL, timeout_bits) |
+		  REG_FIELD_PREP(UART__TIMEOUT_CTRL__EN, timeout_bits != 0) },
+		/* Drop stale events, then enable the RX ones. TX watermark is
+		   enabled on demand by uart_send(). */
+		{ offsetof(UART_t, INTR_STATE), 0xffffffff },
+		{ offsetof(UART_t, INTR_ENABLE),
+		  UART__INTR_ENABLE__RX_WATERMARK_bm | UART__INTR_ENABLE__RX_TIMEOUT_bm |
+		  UART__INTR_ENABLE__RX_OVERFLOW_bm });
+
+	uart_irq_active = 1;
+	pic_register_irq(PIC_IRQ_UART, uart_irq_handler, 1);
+}
+
+size_t uart_recv(void *buf, size_t len)
+{
+	uint8_t *wr = buf;
+	size_t count = uart_rx_ring.head - uart_rx_ring.tail;
+
+	if (count > len)
+		count = len;
+
+	for (size_t i = 0; i < count; i++)
+		wr[i] = uart_rx_ring.data[(uart_rx_ring.tail + i) & UART_RING_MASK];
+
+	asm volatile ("" ::: "memory");
+	uart_rx_ring.tail += count;
+
+	return count;
+}
+
+static int uart_line_ready(uint32_t end)
+{
+	/* The line end trails the ring once uart_recv() has consumed past it. */
+	uint32_t pending = end - uart_rx_ring.tail;
+
+	return pending && pending <= UART_RING_SIZE;
+}
+
+int uart_getline(char *buf, size_t len)
+{
+	uint32_t end = uart_rx_line_end;
+	uint32_t tail = uart_rx_ring.tail;
+	size_t count = 0;
+
+	if (!len || !uart_line_ready(end))
+		return -1;
+
+	while (tail != end && count < len - 1) {
+		char c = uart_rx_ring.data[tail & UART_RING_MASK];
+
+		buf[count++] = c;
+		tail++;
+		if (c == '\n')
+			break;
+	}
+	buf[count] = '\0';
+
+	asm volatile ("" ::: "memory");
+	uart_rx_ring.tail = tail;
+
+	return count;
+}
+
+size_t uart_send(const void *buf, size_t len)
+{
+	const uint8_t *rd = buf;
+	size_t count;
+
+	uint32_t mstatus = csr_read(mstatus);
+	irq_disable();
+
+	count = UART_RING_SIZE - (uart_tx_ring.head - uart_tx_ring.tail);
+	if (count > len)
+		count = len;
+
+	for (size_t i = 0; i < count; i++)
+		uart_tx_ring.data[(uart_tx_ring.head + i) & UART_RING_MASK] = rd[i];
+	uart_tx_ring.head += count;
+
+	/* Start sending right away, the watermark interrupt takes over from
+	   here if the FIFO can't take everything. */
+	uart_refill_tx();
+
+	if (mstatus & MSTATUS_MIE)
+		irq_enable();
+
+	return count;
+}
+
+void uart_wait_for_line()
+{
+	while (1) {
+		irq_disable();
+		if (uart_line_ready(uart_rx_line_end)) {
+			irq_enable();
+			return;
+		}
+
+		wait_for_interrupt();
+		irq_enable();
+	}
+}
+
+uint32_t uart_rx_overflows()
+{
+	return uart_rx_overflow_count;
 }
@@ -5,11 +5,24 @@
 #define UART_H
 
 #include "utils.h"
+#include "uart_registers.h"
+#include <stddef.h>
 #include <stdint.h>
 
 #define UART_BASE	(0x30000000)
 #define UART_BAUD_RATE  (115200)
 
+/* Depth of the UART TX FIFO, in characters. */
+#ifndef UART_TX_FIFO_DEPTH
+#define UART_TX_FIFO_DEPTH	(32)
+#endif
+
+/* Number of bytes in each of the software RX/TX rings of the interrupt-driven
+   driver, must be a power of 2. */
+#ifndef UART_RING_SIZE
+#define UART_RING_SIZE 256
+#endif
+
 #define UART_INTR_STATE_REG      (0x0)
 #define UART_INTR_ENABLE_REG     (0x4)
 #define UART_INTR_TEST_REG       (0x8)
@@ -24,14 +37,32 @@
 #define UART_VAL_REG             (0x2c)
 #define UART_TIMEOUT_CTRL_REG    (0x30)
 
-#define UART_CTRL_NCO_OFFSET		(16)
-#define UART_CTRL_TX_EN			(1 << 0)
-#define UART_CTRL_RX_EN			(1 << 1)
-#define UART_STATUS_TX_IDLE		(1 << 3)
-#define UART_FIFO_CTRL_RXRST		(1 << 0)
-#define UART_FIFO_CTRL_TXRST		(1 << 1)
-#define UART_FIFO_STATUS_TXLVL_MASK	(0xff)
-#define UART_FIFO_STATUS_RXLVL_MASK 	(0xff0000)
+#define UART_REG(reg)	(UART_BASE + offsetof(UART_t, reg))
+
+#define UART_CTRL_NCO_OFFSET		UART__CTRL__NCO_bp
+#define UART_CTRL_TX_EN			UART__CTRL__TX_bm
+#define UART_CTRL_RX_EN			UART__CTRL__RX_bm
+#define UART_STATUS_TX_IDLE		UART__STATUS__TXIDLE_bm
+#define UART_FIFO_CTRL_RXRST		UART__FIFO_CTRL__RXRST_bm
+#define UART_FIFO_CTRL_TXRST		UART__FIFO_CTRL__TXRST_bm
+#define UART_FIFO_STATUS_TXLVL_MASK	UART__FIFO_STATUS__TXLVL_bm
+#define UART_FIFO_STATUS_RXLVL_MASK 	UART__FIFO_STATUS__RXLVL_bm
+
+/* FIFO_CTRL.RXILVL values, the RX watermark interrupt fires once the RX FIFO
+   holds at least this many characters. */
+#define UART_RXILVL_1	(0)
+#define UART_RXILVL_4	(1)
+#define UART_RXILVL_8	(2)
+#define UART_RXILVL_16	(3)
+#define UART_RXILVL_30	(4)
+/* FIFO_CTRL.TXILVL values, the TX watermark interrupt fires once the TX FIFO
+   drops below this many characters. */
+#define UART_TXILVL_1	(0)
+#define UART_TXILVL_4	(1)
+#define UART_TXILVL_8	(2)
+#define UART_TXILVL_16	(3)
+
+static_assert(offsetof(UART_t, TIMEOUT_CTRL) == UART_TIMEOUT_CTRL_REG, "UART register map mismatch");
 
 void uart_init(uint64_t);
 
@@ -39,7 +70,23 @@ int uart_tx_rdy(void);
 
 int uart_rx_empty(void);
 
+void uart_write(const void*, size_t);
+
+void uart_flush(void);
+
 void _putchar(char);
 
 int getchar();
+
+void uart_irq_init(uint32_t, uint32_t, uint32_t);
+
+size_t uart_recv(void*, size_t);
+
+int uart_getline(char*, size_t);
+
+size_t uart_send(const void*, size_t);
+
+void uart_wait_for_line();
+
+uint32_t uart_rx_overflows();
 #endif
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* CRC-32 as used by zlib and Ethernet. Start from CRC32_INIT and invert the
+   result to get the final value, e.g. ~crc32_update(CRC32_INIT, buf, len). */
+
+#define CRC32_INIT	(0xffffffff)
+
+extern const uint32_t crc32_table[256];
+
+static inline uint32_t crc32_byte(uint32_t crc, uint8_t byte)
+{
+	return crc32_table[(crc ^ byte) & 0xff] ^ (crc >> 8);
+}
+
+/* Feeds a little-endian word, for CRCs computed while draining word FIFOs. */
+static inline uint32_t crc32_word(uint32_t crc, uint32_t word)
+{
+	crc = crc32_byte(crc, word);
+	crc = crc32_byte(crc, word >> 8);
+	crc = crc32_byte(crc, word >> 16);
+	return crc32_byte(crc, word >> 24);
+}
+
+uint32_t crc32_update(uint32_t, const void*, size_t);
+
+#endif
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include "lzss.h"
+
+void lzss_init(struct lzss_state *s, void *out, size_t size)
+{
+	s->start = out;
+	s->out = out;
+	s->end = s->start + size;
+	s->flags = 1;
+	s->match_lo = -1;
+}
+
+/* Decodes the next len bytes of the stream. Returns 0 on success and -1 if the
+   stream is corrupt, i.e. refers outside of the output or overruns it. */
+int lzss_feed(struct lzss_state *s, const void *buf, size_t len)
+{
+	const uint8_t *in = buf;
+	const uint8_t *in_end = in + len;
+	uint8_t *out = s->out;
+	uint32_t flags = s->flags;
+	int32_t match_lo = s->match_lo;
+	int ret = 0;
+
+	while (in < in_end) {
+		if (flags == 1) {
+			flags = 0x100 | *in++;
+			continue;
+		}
+
+		if (flags & 1) {
+			if (out == s->end) {
+				ret = -1;
+				break;
+			}
+			*out++ = *in++;
+		} else if (match_lo < 0) {
+			/* Matches may be split between two chunks. */
+			match_lo = *in++;
+			continue;
+		} else {
+			uint8_t hi = *in++;
+			size_t offset = ((hi & 0xf0) << 4 | match_lo) + 1;
+			size_t count = (hi & 0x0f) + LZSS_MIN_MATCH;
+
+			if (offset > (size_t)(out - s->start) || count > (size_t)(s->end - out)) {
+				ret = -1;
+				break;
+			}
+
+			/* Byte by byte, matches may overlap their own output. */
+			const uint8_t *src = out - offset;
+			while (count--)
+				*out++ = *src++;
+
+			match_lo = -1;
+		}
+
+		flags >>= 1;
+	}
+
+	s->out = out;
+	s->flags = flags;
+	s->match_lo = match_lo;
+
+	return ret;
+}
+
+int lzss_done(const struct lzss_state *s)
+{
+	return s->out == s->end && s->match_lo < 0;
+}
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef LZSS_H
+#define LZSS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Streaming LZSS decoder, matching the encoder in tests/sw/tools/mkbootimage.py.
+
+   The stream is a sequence of groups, each a flag byte followed by up to 8
+   items, least significant flag bit first. A set bit is a literal byte, a
+   clear bit a 2-byte match: the low byte of (offset - 1), then the top 4 bits
+   of (offset - 1) in the high nibble and (length - LZSS_MIN_MATCH) in the low
+   nibble. Matches are copied from the output itself, so the window needs no
+   buffer of its own. */
+
+#define LZSS_WINDOW_SIZE	(4096)
+#define LZSS_MIN_MATCH		(3)
+#define LZSS_MAX_MATCH		(LZSS_MIN_MATCH + 15)
+
+struct lzss_state {
+	uint8_t *start;
+	uint8_t *out;
+	uint8_t *end;
+	uint32_t flags;		/* Remaining flag bits, above a sentinel bit. */
+	int32_t match_lo;	/* First byte of a split match, or -1. */
+};
+
+void lzss_init(struct lzss_state*, void*, size_t);
+
+int lzss_feed(struct lzss_state*, const void*, size_t);
+
+int lzss_done(const struct lzss_state*);
+
+#endif
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef REG_H
+#define REG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Header-only MMIO register access.
+
+   Everything here is inlined into the caller, so a register access compiles to
+   a single lw/sw on an address the compiler can fold into its base register,
+   and field masks and shifts are resolved at compile time.
+
+   Field helpers take the name of a field without the _bm/_bp suffix, following
+   the PeakRDL-cheader naming (e.g. i3c_registers.h, uart_registers.h). Names
+   built by other macros are expanded before the suffix is pasted on. */
+
+static inline __attribute__((always_inline)) uint32_t reg_read(uint32_t address)
+{
+	return *(volatile uint32_t *)address;
+}
+
+static inline __attribute__((always_inline)) void reg_write(uint32_t address, uint32_t value)
+{
+	*(volatile uint32_t *)address = value;
+}
+
+/* Read-modify-write: clear the bits in mask, then set the ones in value. */
+static inline __attribute__((always_inline)) void reg_update(uint32_t address, uint32_t mask,
+							       uint32_t value)
+{
+	reg_write(address, (reg_read(address) & ~mask) | (value & mask));
+}
+
+#define __REG_FIELD_MASK(field)		(field##_bm)
+#define __REG_FIELD_GET(field, reg)	(((reg) & field##_bm) >> field##_bp)
+#define __REG_FIELD_PREP(field, val)	(((uint32_t)(val) << field##_bp) & field##_bm)
+
+/* Mask of a field. */
+#define REG_FIELD_MASK(field)		__REG_FIELD_MASK(field)
+/* Extract a field from a register value. */
+#define REG_FIELD_GET(field, reg)	__REG_FIELD_GET(field, reg)
+/* Shift a value into a field's position. */
+#define REG_FIELD_PREP(field, val)	__REG_FIELD_PREP(field, val)
+/* Read a single field of a register. */
+#define REG_READ_FIELD(address, field)	REG_FIELD_GET(field, reg_read(address))
+/* Update a single field of a register, leaving the others intact. */
+#define REG_UPDATE_FIELD(address, field, val) \
+	reg_update(address, REG_FIELD_MASK(field), REG_FIELD_PREP(field, val))
+
+/* Batched writes, for register sequences such as peripheral init. The offsets
+   are relative to the base passed to reg_write_seq(). With a constant table the
+   loop is fully unrolled into one sw per entry. */
+struct reg_write_op {
+	uint32_t offset;
+	uint32_t value;
+};
+
+#define REG_WRITE_SEQ(base, ...) do { \
+	const struct reg_write_op __seq[] = { __VA_ARGS__ }; \
+	reg_write_seq(base, __seq, sizeof(__seq) / sizeof(__seq[0])); \
+} while (0)
+
+static inline __attribute__((always_inline)) void reg_write_seq(uint32_t base,
+								  const struct reg_write_op *seq,
+								  size_t count)
+{
+#pragma GCC unroll 16
+	for (size_t i = 0; i < count; i++)
+		reg_write(base + seq[i].offset, seq[i].value);
+}
+
+#endif
@@ -7,10 +7,29 @@
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdint.h>
+#include "reg.h"
 
 #define SOC_CLOCK_HZ	(32000000L)
 
-void write32(uint32_t address, uint32_t value);
+#define __csr_str(csr) #csr
+#define csr_str(csr) __csr_str(csr)
 
-uint32_t read32(uint32_t address);
+#define csr_read(csr) ({ \
+	uint32_t __v; \
+	asm volatile ("csrr %0, " csr_str(csr) : "=r"(__v)); \
+	__v; \
+})
+#define csr_write(csr, val) asm volatile ("csrw " csr_str(csr) ", %0" :: "rK"(val))
+#define csr_set(csr, val) asm volatile ("csrs " csr_str(csr) ", %0" :: "rK"(val))
+#define csr_clear(csr, val) asm volatile ("csrc " csr_str(csr) ", %0" :: "rK"(val))
+
+static inline __attribute__((always_inline)) void write32(uint32_t address, uint32_t value)
+{
+	reg_write(address, value);
+}
+
+static inline __attribute__((always_inline)) uint32_t read32(uint32_t address)
+{
+	return reg_read(address);
+}
 #endif
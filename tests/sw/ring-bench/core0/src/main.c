@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include <stdint.h>
+#include "printf.h"
+#include "uart.h"
+#include "pic.h"
+#include "ring_bench.h"
+
+/* The stream repeats every RING_BENCH_MAX_BATCH bytes, so a batch starting
+   anywhere in it can be written straight from this buffer. */
+static uint8_t pattern[2 * RING_BENCH_MAX_BATCH];
+
+static uint32_t send(struct ring *r, uint32_t batch, int notify)
+{
+	uint32_t sent = 0;
+	uint32_t start = csr_read(mcycle);
+
+	ring_set_notify(r, 1, notify ? BELL_DATA : 0);
+
+	while (sent < RING_BENCH_BYTES) {
+		uint32_t len = RING_BENCH_BYTES - sent < batch ? RING_BENCH_BYTES - sent : batch;
+		size_t count = ring_write(r, &pattern[sent % RING_BENCH_MAX_BATCH], len);
+
+		sent += count;
+		if (!count && notify)
+			ipc_wait(BELL_SPACE);
+	}
+
+	ipc_wait(BELL_DONE);
+
+	return csr_read(mcycle) - start;
+}
+
+int main(void)
+{
+	struct ring r;
+
+	uart_init(UART_BAUD_RATE);
+	pic_init();
+	ipc_init(0);
+	irq_enable();
+
+	for (uint32_t i = 0; i < sizeof(pattern); i++)
+		pattern[i] = ring_bench_byte(i);
+
+	ring_create(&r, RING_BENCH_BASE, RING_BENCH_SIZE);
+	ipc_ring(1, BELL_READY);
+
+	for (uint32_t i = 0; i < RING_BENCH_ROUNDS; i++) {
+		uint32_t batch = ring_bench_rounds[i].batch;
+		int notify = ring_bench_rounds[i].notify;
+		uint32_t cycles = send(&r, batch, notify);
+
+		printf("RING: batch %u, %s: %u bytes in %u cycles, %u bytes/kcycle\r\n",
+		       batch, notify ? "doorbell" : "polling", RING_BENCH_BYTES, cycles,
+		       (uint32_t)((uint64_t)RING_BENCH_BYTES * 1000 / cycles));
+	}
+
+	return 0;
+}
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#include <stdint.h>
+#include "printf.h"
+#include "pic.h"
+#include "ring_bench.h"
+
+static uint8_t buf[RING_BENCH_MAX_BATCH];
+
+/* Only the first and the last byte of every read are checked, so that the
+   check doesn't slow the reader down. Returns the number of bad reads. */
+static uint32_t receive(struct ring *r, uint32_t batch, int notify)
+{
+	uint32_t received = 0;
+	uint32_t errors = 0;
+
+	ring_set_notify(r, 0, notify ? BELL_SPACE : 0);
+
+	while (received < RING_BENCH_BYTES) {
+		uint32_t len = RING_BENCH_BYTES - received < batch ? RING_BENCH_BYTES - received : batch;
+		size_t count = ring_read(r, buf, len);
+
+		if (!count) {
+			if (notify)
+				ipc_wait(BELL_DATA);
+			continue;
+		}
+
+		if (buf[0] != ring_bench_byte(received) ||
+		    buf[count - 1] != ring_bench_byte(received + count - 1))
+			errors++;
+		received += count;
+	}
+
+	ipc_ring(0, BELL_DONE);
+
+	return errors;
+}
+
+int main(void)
+{
+	struct ring r;
+	uint32_t errors = 0;
+
+	pic_init();
+	ipc_init(1);
+	irq_enable();
+
+	ipc_wait(BELL_READY);
+	ring_attach(&r, RING_BENCH_BASE, RING_BENCH_SIZE);
+
+	for (uint32_t i = 0; i < RING_BENCH_ROUNDS; i++)
+		errors += receive(&r, ring_bench_rounds[i].batch, ring_bench_rounds[i].notify);
+
+	/* Printed to the mailbox console of this core. */
+	printf("RING: %u bad reads\r\n", errors);
+
+	return errors != 0;
+}
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (c) 2026 Antmicro <www.antmicro.com>
+
+#ifndef RING_BENCH_H
+#define RING_BENCH_H
+
+#include <stdint.h>
+#include "ipc.h"
+#include "ring.h"
+
+/* Core 0 streams RING_BENCH_BYTES to core 1 through a ring in the shared
+   memory once for every round, in writes of at most the given batch size, and
+   core 1 reads it back in reads of the same size. With notify, a side finding
+   the ring full (or empty) sleeps until the other one rings its doorbell,
+   otherwise it polls the index of the other side. */
+
+#define RING_BENCH_BASE		((void *)IPC_SHMEM_BASE)
+#define RING_BENCH_SIZE		(4096)
+#define RING_BENCH_BYTES	(16384)
+#define RING_BENCH_MAX_BATCH	(2048)
+
+#define BELL_READY	(1 << 0)
+#define BELL_DATA	(1 << 1)
+#define BELL_SPACE	(1 << 2)
+#define BELL_DONE	(1 << 3)
+
+static const struct {
+	uint32_t batch;
+	int notify;
+} ring_bench_rounds[] = {
+	{ 16, 0 }, { 256, 0 }, { 2048, 0 },
+	{ 16, 1 }, { 256, 1 }, { 2048, 1 },
+};
+
+#define RING_BENCH_ROUNDS	(sizeof(ring_bench_rounds) / sizeof(ring_bench_rounds[0]))
+
+/* Byte at the given offset of the stream. */
+static inline uint8_t ring_bench_byte(uint32_t offset)
+{
+	return offset * 7;
+}
+
+#endif
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Antmicro <www.antmicro.com>
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Collects the "@B" result lines printed by tests/sw/libs/bench.
+
+The input files are console logs of the testbench (console.log, console1.log) or
+its whole output, where lines of core 1 are prefixed with "[CORE1]: ". The results
+are printed as a table and can be saved as CSV. With --baseline, the minimum cycle
+counts are compared with a CSV file saved earlier and the script fails if any of
+them grew by more than the threshold.
+"""
+
+import argparse
+import csv
+import re
+import sys
+from pathlib import Path
+
+RESULT_RE = re.compile(r"(?:\[CORE(\d+)\]: )?@B((?: \w+=\S+)+)")
+FIELDS = ["cycles_min", "cycles_avg", "cycles_max", "instret"]
+
+
+def parse(path: Path, default_core: str) -> dict[tuple[str, str], dict[str, int]]:
+    results = {}
+    for line in path.read_text(errors="replace").splitlines():
+        match = RESULT_RE.search(line)
+        if match is None:
+            continue
+
+        values = dict(field.split("=", 1) for field in match.group(2).split())
+        key = (match.group(1) or default_core, values.pop("name"))
+        results[key] = {k: int(v) for k, v in values.items()}
+
+    return results
+
+
+def load_csv(path: Path) -> dict[tuple[str, str], dict[str, int]]:
+    with path.open(newline="") as f:
+        rows = csv.DictReader(f)
+        return {(row["core"], row["name"]): {k: int(row[k]) for k in FIELDS} for row in rows}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("logs", type=Path, nargs="+", help="console logs or testbench output")
+    parser.add_argument("--csv", type=Path, help="save the results in a CSV file")
+    parser.add_argument("--baseline", type=Path, help="CSV file with the reference results")
+    parser.add_argument(
+        "--threshold", type=float, default=5, help="allowed cycles_min increase [%%]"
+    )
+    args = parser.parse_args()
+
+    results = {}
+    for log in args.logs:
+        # console1.log only holds the output of core 1.
+        results.update(parse(log, "1" if log.name == "console1.log" else "0"))
+
+    if not results:
+        sys.exit("No benchmark results found")
+
+    baseline = load_csv(args.baseline) if args.baseline else {}
+    regressions = 0
+
+    print(f"{'core':>4} {'name':<28} " + " ".join(f"{f:>10}" for f in FIELDS) + "     change")
+    for (core, name), values in sorted(results.items()):
+        line = f"{core:>4} {name:<28} " + " ".join(f"{values[f]:>10}" for f in FIELDS)
+
+        reference = baseline.get((core, name))
+        if reference:
+            change = (values["cycles_min"] / max(reference["cycles_min"], 1) - 1) * 100
+            line += f" {change:+9.1f}%"
+            if change > args.threshold:
+                line += " REGRESSION"
+                regressions += 1
+        print(line)
+
+    if args.csv:
+        with args.csv.open("w", newline="") as f:
+            writer = csv.writer(f)
+            writer.writerow(["core", "name", *FIELDS])
+            for (core, name), values in sorted(results.items()):
+                writer.writerow([core, name, *(values[f] for f in FIELDS)])
+
+    if regressions:
+        sys.exit(f"{regressions} benchmarks regressed by more than {args.threshold}%")
+
+
+if __name__ == "__main__":
+    main()
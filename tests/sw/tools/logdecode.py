@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Antmicro <www.antmicro.com>
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Decodes deferred log records written by tests/sw/libs/log.
+
+Lines containing "@L <word>..." records are replaced with the formatted message,
+looked up by its offset in the .log_fmt section of the firmware ELF file. All
+other lines are passed through unchanged, so a whole UART capture can be fed in.
+"""
+
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+from mkbootimage import load_segments
+
+RECORD_RE = re.compile(r"@L((?: [0-9a-f]{8})+)")
+DROPPED_RE = re.compile(r"@D (\d+)")
+CONVERSION_RE = re.compile(r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+))?(?:hh|h|ll|l|z|j|t)?([diuoxXcsp%])")
+
+
+def find_section(elf: bytes, name: str) -> bytes:
+    shoff = struct.unpack_from("<I", elf, 32)[0]
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", elf, 46)
+
+    def header(i):
+        return struct.unpack_from("<10I", elf, shoff + i * shentsize)
+
+    strtab = header(shstrndx)
+    for i in range(shnum):
+        sh_name, _, _, _, sh_offset, sh_size, *_ = header(i)
+        start = strtab[4] + sh_name
+        if elf[start : elf.index(b"\0", start)].decode() == name:
+            return elf[sh_offset : sh_offset + sh_size]
+
+    raise ValueError(f"No {name} section in the ELF file")
+
+
+def load_symbols(path: Path) -> list[tuple[int, str]]:
+    """Reads the `nm -B -n` output that common.mk stores next to the ELF file."""
+
+    symbols = []
+    for line in path.read_text().splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[1] in "TtDdBbRr":
+            symbols.append((int(fields[0], 16), fields[2]))
+
+    return symbols
+
+
+class Decoder:
+    def __init__(self, elf: bytes, symbols: list[tuple[int, str]]):
+        self.formats = find_section(elf, ".log_fmt")
+        self.segments = load_segments(elf)[1]
+        self.symbols = symbols
+
+    def c_string(self, data: bytes, offset: int) -> str:
+        return data[offset : data.index(b"\0", offset)].decode("utf-8", "replace")
+
+    def target_string(self, addr: int) -> str:
+        for base, contents, _ in self.segments:
+            if base <= addr < base + len(contents):
+                return self.c_string(contents, addr - base)
+
+        return f"<0x{addr:08x}>"
+
+    def symbolize(self, addr: int) -> str:
+        best = None
+        for sym_addr, name in self.symbols:
+            if sym_addr > addr:
+                break
+            best = (sym_addr, name)
+
+        if best is None:
+            return f"0x{addr:08x}"
+        return f"0x{addr:08x} <{best[1]}+0x{addr - best[0]:x}>"
+
+    def format(self, fmt: str, args: list[int]) -> str:
+        args = list(args)
+
+        def convert(match: re.Match) -> str:
+            flags, width, precision, conv = match.groups()
+            if conv == "%":
+                return "%"
+
+            if width == "*":
+                width = str(args.pop(0))
+            spec = "%" + flags + (width or "") + (f".{precision}" if precision else "")
+            arg = args.pop(0) if args else 0
+
+            if conv in "di":
+                return (spec + "d") % (arg - (1 << 32) if arg & (1 << 31) else arg)
+            if conv == "u":
+                return (spec + "d") % arg
+            if conv in "oxX":
+                return (spec + conv) % arg
+            if conv == "c":
+                return (spec + "c") % chr(arg & 0xFF)
+            if conv == "s":
+                return (spec + "s") % self.target_string(arg)
+            return (spec + "s") % self.symbolize(arg)
+
+        return CONVERSION_RE.sub(convert, fmt)
+
+    def decode(self, line: str, timestamps: bool) -> str:
+        match = RECORD_RE.search(line)
+        if match is None:
+            dropped = DROPPED_RE.search(line)
+            if dropped is not None:
+                return f"<{dropped.group(1)} log records dropped>"
+            return line
+
+        words = [int(word, 16) for word in match.group(1).split()]
+        header, cycle, args = words[0], words[1], words[2:]
+        text = self.format(self.c_string(self.formats, header >> 8), args).rstrip("\r\n")
+
+        return f"[{cycle:10d}] {text}" if timestamps else text
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elf", type=Path, help="firmware ELF file")
+    parser.add_argument("input", type=Path, nargs="?", help="captured output, stdin by default")
+    parser.add_argument("--sym", type=Path, help="nm output, <elf>.sym by default")
+    parser.add_argument(
+        "--no-timestamps", action="store_true", help="omit the mcycle timestamp of each record"
+    )
+    args = parser.parse_args()
+
+    sym = args.sym or args.elf.with_suffix(".sym")
+    decoder = Decoder(args.elf.read_bytes(), load_symbols(sym) if sym.exists() else [])
+
+    lines = args.input.read_text().splitlines() if args.input else sys.stdin.read().splitlines()
+    for line in lines:
+        print(decoder.decode(line, not args.no_timestamps))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Antmicro <www.antmicro.com>
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Converts a RISC-V ELF file into a segmented streaming boot image.
+
+The layout is described in tests/sw/libs/i3c/boot_image.h: a header, a table of
+segment descriptors, the word-padded contents of every PT_LOAD segment and an
+optional CRC-32 trailer. Segment contents can optionally be LZSS-compressed, in
+the format decoded by tests/sw/libs/utils/lzss.c.
+"""
+
+import argparse
+import struct
+import zlib
+from pathlib import Path
+
+BOOT_IMAGE_MAGIC = 0x49425647
+BOOT_IMAGE_MAX_SEGMENTS = 8
+
+BOOT_IMAGE_FLAG_CRC32 = 1 << 0
+BOOT_IMAGE_FLAG_LZSS = 1 << 1
+
+LZSS_WINDOW_SIZE = 4096
+LZSS_MIN_MATCH = 3
+LZSS_MAX_MATCH = LZSS_MIN_MATCH + 15
+
+PT_LOAD = 1
+
+
+def load_segments(elf: bytes) -> tuple[int, list[tuple[int, bytes, int]]]:
+    """Returns the entry point and (address, contents, memory size) of every PT_LOAD segment."""
+
+    if elf[:4] != b"\x7fELF" or elf[4] != 1 or elf[5] != 1:
+        raise ValueError("Expected a 32-bit little-endian ELF file")
+
+    entry, phoff = struct.unpack_from("<II", elf, 24)
+    phentsize, phnum = struct.unpack_from("<HH", elf, 42)
+
+    segments = []
+    for i in range(phnum):
+        p_type, p_offset, _, p_paddr, p_filesz, p_memsz = struct.unpack_from(
+            "<6I", elf, phoff + i * phentsize
+        )
+        if p_type != PT_LOAD or p_memsz == 0:
+            continue
+
+        segments.append((p_paddr, elf[p_offset : p_offset + p_filesz], p_memsz))
+
+    return entry, segments
+
+
+def lzss_compress(data: bytes) -> bytes:
+    """Greedy LZSS with a LZSS_WINDOW_SIZE window, see tests/sw/libs/utils/lzss.h."""
+
+    out = bytearray()
+    chains: dict[bytes, list[int]] = {}
+    pos = 0
+
+    while pos < len(data):
+        flags_pos = len(out)
+        out.append(0)
+
+        for bit in range(8):
+            if pos >= len(data):
+                break
+
+            best_len, best_off = 0, 0
+            key = data[pos : pos + LZSS_MIN_MATCH]
+            for cand in reversed(chains.get(key, [])):
+                if pos - cand > LZSS_WINDOW_SIZE:
+                    break
+                length = 0
+                while (
+                    length < LZSS_MAX_MATCH
+                    and pos + length < len(data)
+                    and data[cand + length] == data[pos + length]
+                ):
+                    length += 1
+                if length > best_len:
+                    best_len, best_off = length, pos - cand
+                    if length == LZSS_MAX_MATCH:
+                        break
+
+            if best_len >= LZSS_MIN_MATCH:
+                off = best_off - 1
+                out += bytes([off & 0xFF, (off >> 4) & 0xF0 | (best_len - LZSS_MIN_MATCH)])
+                step = best_len
+            else:
+                out[flags_pos] |= 1 << bit
+                out.append(data[pos])
+                step = 1
+
+            for i in range(pos, pos + step):
+                chains.setdefault(data[i : i + LZSS_MIN_MATCH], []).append(i)
+            pos += step
+
+    return bytes(out)
+
+
+def build_image(
+    entry: int, segments: list[tuple[int, bytes, int]], crc32: bool = False, lzss: bool = False
+) -> bytes:
+    if len(segments) > BOOT_IMAGE_MAX_SEGMENTS:
+        raise ValueError(f"Too many segments: {len(segments)} > {BOOT_IMAGE_MAX_SEGMENTS}")
+
+    flags = (BOOT_IMAGE_FLAG_CRC32 if crc32 else 0) | (BOOT_IMAGE_FLAG_LZSS if lzss else 0)
+    image = struct.pack("<4I", BOOT_IMAGE_MAGIC, entry, len(segments), flags)
+
+    for addr, data, mem_size in segments:
+        if addr % 4:
+            raise ValueError(f"Segment at 0x{addr:08x} is not word-aligned")
+        image += struct.pack("<3I", addr, len(data), mem_size)
+
+    for _, data, _ in segments:
+        if lzss:
+            # Compressed segments are prefixed with their compressed size.
+            data = lzss_compress(data)
+            image += struct.pack("<I", len(data))
+        image += data + bytes(-len(data) % 4)
+
+    if crc32:
+        image += struct.pack("<I", zlib.crc32(image))
+
+    return image
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elf", type=Path, help="input ELF file")
+    parser.add_argument("output", type=Path, help="output boot image")
+    parser.add_argument("--crc32", action="store_true", help="append a CRC-32 trailer")
+    parser.add_argument("--lzss", action="store_true", help="LZSS-compress the segments")
+    args = parser.parse_args()
+
+    entry, segments = load_segments(args.elf.read_bytes())
+    image = build_image(entry, segments, args.crc32, args.lzss)
+    args.output.write_bytes(image)
+
+    for addr, data, mem_size in segments:
+        print(f"0x{addr:08x}: {len(data)} B loaded, {mem_size} B in memory")
+    print(f"Entry 0x{entry:08x}, image size {len(image)} B")
+
+
+if __name__ == "__main__":
+    main()
@@ -4,15 +4,83 @@
 #include <stdint.h>
 #include "uart.h"
 #include "printf.h"
+#include "log.h"
+
+#define THROUGHPUT_TEST_LEN	(128)
+
+/* Previous _putchar(): wait for the whole FIFO and the shift register to drain
+   before every character. */
+static void uart_write_idle_wait(const char *buf, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		while (!uart_tx_rdy())
+			;
+		write32(UART_BASE + UART_WDATA_REG, buf[i]);
+	}
+}
+
+/* Percentage of the line rate achieved for sending len characters in the
+   given number of cycles, with 10 bits (8N1) on the wire per character. */
+static uint32_t baud_utilisation(size_t len, uint32_t cycles)
+{
+	uint32_t ideal = len * 10 * (SOC_CLOCK_HZ / UART_BAUD_RATE);
+
+	return cycles ? ideal * 100 / cycles : 0;
+}
+
+static void test_uart_throughput()
+{
+	static char text[THROUGHPUT_TEST_LEN + 1];
+	uint32_t start, idle_wait_cycles, fifo_cycles;
+
+	for (size_t i = 0; i < THROUGHPUT_TEST_LEN - 2; i++)
+		text[i] = 'a' + i % 26;
+	text[THROUGHPUT_TEST_LEN - 2] = '\r';
+	text[THROUGHPUT_TEST_LEN - 1] = '\n';
+
+	uart_flush();
+	start = csr_read(mcycle);
+	uart_write_idle_wait(text, THROUGHPUT_TEST_LEN);
+	uart_flush();
+	idle_wait_cycles = csr_read(mcycle) - start;
+
+	start = csr_read(mcycle);
+	uart_write(text, THROUGHPUT_TEST_LEN);
+	uart_flush();
+	fifo_cycles = csr_read(mcycle) - start;
+
+	printf("UART throughput: idle-wait %u cycles (%u%%), uart_write %u cycles (%u%%)\r\n",
+	       idle_wait_cycles, baud_utilisation(THROUGHPUT_TEST_LEN, idle_wait_cycles),
+	       fifo_cycles, baud_utilisation(THROUGHPUT_TEST_LEN, fifo_cycles));
+}
+
+static void test_deferred_log()
+{
+	uint32_t start, printf_cycles, log_cycles;
+
+	/* The same message, formatted on the core and written to the UART, and
+	   recorded for decoding on the host. */
+	start = csr_read(mcycle);
+	printf("Sample %d: status 0x%08x\r\n", 1, 0x1234abcd);
+	printf_cycles = csr_read(mcycle) - start;
+
+	start = csr_read(mcycle);
+	LOG("Sample %d: status 0x%08x\r\n", 1, 0x1234abcd);
+	log_cycles = csr_read(mcycle) - start;
+
+	LOG("printf %u cycles, LOG %u cycles\r\n", printf_cycles, log_cycles);
+	log_flush();
+
+	printf("Logging cost: printf %u cycles, LOG %u cycles\r\n", printf_cycles, log_cycles);
+}
 
 int main(void)
 {
-	int i = 0;
-	while(i <= 5000) {
-		i++;
-	} //Wait for second core to print
 	uart_init(UART_BAUD_RATE);
 	printf("Hello from core 0\r\n");
 
+	test_uart_throughput();
+	test_deferred_log();
+
 	return 0;
 }
@@ -7,7 +7,8 @@
 
 int main(void)
 {
-	uart_init(UART_BAUD_RATE);
+	/* Printed to the mailbox console of this core (CONSOLE=mailbox in the
+	   Makefile), core 0 owns the UART. */
 	printf("Hello from core 1\r\n");
 
 	return 0;
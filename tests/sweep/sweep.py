@@ -0,0 +1,331 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Antmicro <www.antmicro.com>
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Sweeps VeeR configurations over a set of benchmark firmware.
+
+Every configuration from the configuration file is built into its own VeeR
+snapshot and Verilator testbench (PROFILE=sweep-<name> in the root Makefile).
+Each test is then run on core 0 of the singlecore design and minstret/mcycle are
+read from the end-of-simulation report. The CPI of every test and a storage-based
+area proxy of every configuration are printed as a Markdown table and saved, with
+the raw counters, in the output directory.
+"""
+
+import argparse
+import csv
+import math
+import re
+import shutil
+import subprocess
+import sys
+from pathlib import Path
+
+import yaml
+
+ROOT_DIR = Path(__file__).resolve().parents[2]
+
+REPORT_RE = re.compile(r"Finished : minstret = (\d+), mcycle = (\d+)")
+NAME_RE = re.compile(r"[A-Za-z0-9_-]+$")
+
+# veer.config defaults of the options used by the area proxy, for those that the
+# configuration flags don't set.
+VEER_DEFAULTS = {
+    "iccm_enable": 0,
+    "iccm_size": 64,
+    "dccm_enable": 1,
+    "dccm_size": 64,
+    "icache_enable": 1,
+    "icache_size": 16,
+    "btb_enable": 1,
+    "btb_size": 512,
+    "bht_size": 512,
+    "ret_stack_size": 8,
+    "dma_buf_depth": 5,
+    "div_bit": 4,
+}
+
+
+def parse_options(flags: list[str]) -> dict[str, int]:
+    """Returns the values of the veer.config options set by the flags, later flags win."""
+
+    options = {}
+    for flag in flags:
+        if flag.startswith("-set="):
+            name, _, value = flag[len("-set=") :].partition("=")
+            options[name] = int(value, 0)
+        elif flag.startswith("-unset="):
+            options.pop(flag[len("-unset=") :], None)
+
+    return options
+
+
+def storage_kbits(options: dict[str, int]) -> float:
+    """
+    Storage added by the configurable blocks of the core, a rough proxy of its area.
+
+    The ICCM and DCCM keep 7 ECC bits per 32-bit word. BTB and return stack entries
+    are counted as 32 bits and BHT entries as 2-bit counters. The tags of the
+    instruction cache and the logic of the divider aren't included, the width of
+    the divider is reported separately.
+    """
+
+    def option(name):
+        return options.get(name, VEER_DEFAULTS[name])
+
+    bits = 0
+    if option("iccm_enable"):
+        bits += option("iccm_size") * 1024 * 8 * 39 // 32
+    if option("dccm_enable"):
+        bits += option("dccm_size") * 1024 * 8 * 39 // 32
+    if option("icache_enable"):
+        bits += option("icache_size") * 1024 * 8
+    if option("btb_enable"):
+        bits += option("btb_size") * 32 + option("bht_size") * 2 + option("ret_stack_size") * 32
+    bits += option("dma_buf_depth") * 64
+
+    return bits / 1024
+
+
+def run(cmd: list[str], log: Path, cwd: Path = ROOT_DIR, timeout: float = None) -> str:
+    """Runs the command with its output saved to the log, raises on failure."""
+
+    log.parent.mkdir(parents=True, exist_ok=True)
+    result = subprocess.run(
+        cmd,
+        cwd=cwd,
+        stdout=subprocess.PIPE,
+        stderr=subprocess.STDOUT,
+        text=True,
+        timeout=timeout,
+    )
+    log.write_text(result.stdout)
+    if result.returncode != 0:
+        raise RuntimeError(f"{cmd[0]} failed with code {result.returncode}, see {log}")
+
+    return result.stdout
+
+
+class Sweep:
+    def __init__(self, args: argparse.Namespace):
+        self.args = args
+        self.out_dir = args.output
+        self.profile_flags = {
+            "default": args.default_flags.split(),
+            "perf": args.default_flags.split() + args.perf_flags.split(),
+        }
+
+    def config_flags(self, config: dict) -> list[str]:
+        flags = list(self.profile_flags[config["profile"]])
+        for name, value in config.get("set", {}).items():
+            flags.append(f"-set={name}={value}")
+
+        return flags
+
+    def build_testbench(self, name: str, flags: list[str]) -> Path:
+        """Builds the testbench of a configuration, rebuilding it if the flags changed."""
+
+        profile = f"sweep-{name}"
+        obj_dir = ROOT_DIR / "build" / f"obj_dir_{profile}"
+        stamp = self.out_dir / name / "veer_flags"
+
+        if not stamp.exists() or stamp.read_text() != " ".join(flags):
+            shutil.rmtree(obj_dir, ignore_errors=True)
+            shutil.rmtree(ROOT_DIR / "build" / "snapshots" / profile, ignore_errors=True)
+
+        print(f"Building the testbench of {name}", file=sys.stderr)
+        run(
+            [
+                "make",
+                "testbench",
+                "DESIGN=singlecore",
+                f"PROFILE={profile}",
+                f"VEER_CONFIGURATION_FLAGS={' '.join(flags)}",
+            ],
+            self.out_dir / name / "testbench.log",
+        )
+        stamp.write_text(" ".join(flags))
+
+        return obj_dir / "Vguineveer_tb"
+
+    def build_software(self, profile: str, test: str) -> Path:
+        """Builds a test for a profile, each in its own build directory."""
+
+        build_dir = self.out_dir / "sw" / profile / test
+        run(
+            [
+                "make",
+                "-C",
+                str(ROOT_DIR / "tests" / "sw" / test / "core0"),
+                "build",
+                f"BUILD_DIR={build_dir}",
+                f"PICOLIBC_DIR={self.out_dir / 'sw' / 'picolibc'}",
+                f"PROFILE={profile}",
+                f"CONSOLE={self.args.console}",
+            ],
+            build_dir / "build.log",
+        )
+
+        return build_dir
+
+    def simulate(self, name: str, testbench: Path, sw_dir: Path, test: str) -> tuple[int, int]:
+        run_dir = self.out_dir / name / test
+        run_dir.mkdir(parents=True, exist_ok=True)
+
+        # The ELF file also holds the CCM sections of the perf profile.
+        cmd = [str(testbench), f"+firmware0={sw_dir / (test + '.elf')}"]
+
+        output = run(cmd, run_dir / "sim.log", cwd=run_dir, timeout=self.args.timeout)
+        match = REPORT_RE.search(output)
+        if match is None or "TEST_FAILED" in output:
+            raise RuntimeError(f"{test} failed on {name}, see {run_dir / 'sim.log'}")
+
+        return int(match.group(1)), int(match.group(2))
+
+    def run(self, configs: dict[str, dict]) -> list[dict]:
+        results = []
+        sw_dirs = {}
+
+        for name, config in configs.items():
+            flags = self.config_flags(config)
+            result = {
+                "name": name,
+                "profile": config["profile"],
+                "options": parse_options(flags),
+                "tests": {},
+            }
+            results.append(result)
+
+            try:
+                testbench = self.build_testbench(name, flags)
+            except RuntimeError as e:
+                print(e, file=sys.stderr)
+                continue
+
+            for test in self.args.tests:
+                try:
+                    key = (config["profile"], test)
+                    if key not in sw_dirs:
+                        sw_dirs[key] = self.build_software(*key)
+                    print(f"Running {test} on {name}", file=sys.stderr)
+                    result["tests"][test] = self.simulate(name, testbench, sw_dirs[key], test)
+                except (RuntimeError, subprocess.TimeoutExpired) as e:
+                    print(e, file=sys.stderr)
+
+        return results
+
+
+def load_configs(path: Path, only: list[str]) -> dict[str, dict]:
+    configs = yaml.safe_load(path.read_text())
+
+    for name, config in configs.items():
+        if not NAME_RE.match(name):
+            raise ValueError(f"Invalid configuration name: {name}")
+        config = configs[name] = config or {}
+        config.setdefault("profile", "default")
+        if config["profile"] not in ("default", "perf"):
+            raise ValueError(f"{name}: unknown profile {config['profile']}")
+
+    if only:
+        configs = {name: configs[name] for name in only}
+
+    return configs
+
+
+def cpi(counters: tuple[int, int]) -> float:
+    minstret, mcycle = counters
+    return mcycle / minstret
+
+
+def write_table(results: list[dict], tests: list[str], path: Path):
+    header = ["config", "profile", "storage [kbit]", "div_bit"]
+    header += [f"{test} CPI" for test in tests] + ["geomean CPI", "speedup"]
+
+    def geomean(result):
+        if len(result["tests"]) != len(tests):
+            return None
+        return math.exp(sum(math.log(cpi(c)) for c in result["tests"].values()) / len(tests))
+
+    reference = geomean(results[0]) if results else None
+    rows = []
+    for result in results:
+        mean = geomean(result)
+        row = [
+            result["name"],
+            result["profile"],
+            f"{storage_kbits(result['options']):.1f}",
+            str(result["options"].get("div_bit", VEER_DEFAULTS["div_bit"])),
+        ]
+        row += [f"{cpi(result['tests'][t]):.3f}" if t in result["tests"] else "fail" for t in tests]
+        row.append(f"{mean:.3f}" if mean else "-")
+        row.append(f"{reference / mean:.3f}" if mean and reference else "-")
+        rows.append(row)
+
+    lines = ["| " + " | ".join(header) + " |", "|" + "---|" * len(header)]
+    lines += ["| " + " | ".join(row) + " |" for row in rows]
+    table = "\n".join(lines) + "\n"
+
+    path.write_text(table)
+    print(table)
+
+
+def write_csv(results: list[dict], tests: list[str], path: Path):
+    with path.open("w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(["config", "profile", "storage_kbit", "test", "minstret", "mcycle", "cpi"])
+        for result in results:
+            for test in tests:
+                counters = result["tests"].get(test)
+                writer.writerow(
+                    [
+                        result["name"],
+                        result["profile"],
+                        f"{storage_kbits(result['options']):.1f}",
+                        test,
+                        *(counters or ("", "")),
+                        f"{cpi(counters):.4f}" if counters else "",
+                    ]
+                )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--configs",
+        type=Path,
+        default=Path(__file__).parent / "configs.yaml",
+        help="YAML file with the configurations",
+    )
+    parser.add_argument(
+        "--only", nargs="+", default=[], help="names of the configurations to run, all by default"
+    )
+    parser.add_argument("--tests", nargs="+", default=["bench"], help="tests to run")
+    parser.add_argument(
+        "--default-flags", required=True, help="VeeR configuration flags of the default profile"
+    )
+    parser.add_argument(
+        "--perf-flags", required=True, help="flags added by the perf profile (root Makefile)"
+    )
+    parser.add_argument(
+        "--console", default="mailbox", help="console backend of the software (CONSOLE)"
+    )
+    parser.add_argument("--timeout", type=float, default=3600, help="timeout of a simulation [s]")
+    parser.add_argument(
+        "--output", type=Path, default=ROOT_DIR / "build" / "sweep", help="output directory"
+    )
+    args = parser.parse_args()
+    args.output = args.output.resolve()
+    args.output.mkdir(parents=True, exist_ok=True)
+
+    results = Sweep(args).run(load_configs(args.configs, args.only))
+
+    write_csv(results, args.tests, args.output / "results.csv")
+    write_table(results, args.tests, args.output / "results.md")
+
+    if any(len(result["tests"]) != len(args.tests) for result in results):
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()